@@ -37,6 +37,158 @@ extern "C" {
 //#define QLIB_HASH_OPTIMIZATION_ENABLED
 //#define QLIB_SPI_OPTIMIZATION_ENABLED
 
+
+/************************************************************************************************************
+ * Enable streaming HASH implementation. If defined, the platform implements PLAT_HASH_Init, PLAT_HASH_Update and
+ * PLAT_HASH_Final, which calculate the same hash as PLAT_HASH over data given in chunks.
+ * PLAT_HASH_CTX_SIZE may be defined to the size of the platform hash state in bytes.
+************************************************************************************************************/
+//#define QLIB_HASH_STREAM_ENABLED
+//#define PLAT_HASH_CTX_SIZE 112
+
+
+/************************************************************************************************************
+ * define QLIB_SEC_READ_CACHE_SIZE to the number of 32 bytes decrypted pages cached in QLIB context.
+ * If defined, secure reads from sections enabled by QLIB_ReadCache_Enable are served from an LRU cache.
+************************************************************************************************************/
+//example for 8 pages cache
+//#define QLIB_SEC_READ_CACHE_SIZE 8
+
+
+/************************************************************************************************************
+ * Enable sequential secure read-ahead. When consecutive QLIB_Read calls are detected, the secure read of the
+ * next page is left in flight between the calls. Every read-ahead which is not used costs one transaction
+ * counter increment.
+************************************************************************************************************/
+//#define QLIB_SEC_READ_AHEAD_ENABLED
+
+
+/************************************************************************************************************
+ * Enable digest authentication of whole section reads. An authenticated QLIB_Read of a whole section (the active
+ * half of a rollback protected section) is performed by non-authenticated secure reads, and authenticated by a
+ * single section digest calculated by the device. Requires QLIB_HASH_STREAM_ENABLED.
+ * QLIB_SEC_READ_DIGEST_AUTH_CHUNK may be defined to the size of the chunks read and hashed.
+************************************************************************************************************/
+//#define QLIB_SEC_READ_DIGEST_AUTH_ENABLED
+
+
+/************************************************************************************************************
+ * Enable asynchronous SPI transactions. If defined, the platform implements PLAT_SPI_WriteReadTransaction_Async
+ * and PLAT_SPI_WriteReadTransaction_Async_Wait, and the multi-page secure reads build the next cipher key
+ * while the current page is transferred on the bus.
+************************************************************************************************************/
+//#define QLIB_SPI_ASYNC_ENABLED
+
+
+/************************************************************************************************************
+ * Enable platform wait while the flash is busy. If defined, the platform implements PLAT_SPI_WaitWhileBusy
+ * which is called between status polls.
+************************************************************************************************************/
+//#define QLIB_PLAT_WAIT_ENABLED
+
+
+/************************************************************************************************************
+ * Enable platform time functions. If defined, the platform implements PLAT_GetTimeUs and PLAT_DelayUs, which are
+ * used by the time measurement samples. Features which need these functions enable them regardless.
+************************************************************************************************************/
+//#define QLIB_PLAT_TIME_ENABLED
+
+
+/************************************************************************************************************
+ * define QLIB_OP_TIME_MODEL_SIZE to the number of operation types (command and data size) which completion time
+ * is learned in QLIB context. If defined, the platform implements PLAT_GetTimeUs and PLAT_DelayUs, and the first
+ * status poll of program, erase and signature commands is issued just before their predicted completion.
+************************************************************************************************************/
+//example for 8 operation types
+//#define QLIB_OP_TIME_MODEL_SIZE 8
+
+
+/************************************************************************************************************
+ * define QLIB_IRQ_OFF_STATS_SIZE to the number of command types which longest interrupts masked window is
+ * measured in QLIB context. If defined, the platform implements PLAT_GetTimeUs.
+************************************************************************************************************/
+//example for 16 command types
+//#define QLIB_IRQ_OFF_STATS_SIZE 16
+
+
+/************************************************************************************************************
+ * Enable SPI transaction descriptors. If defined, the platform implements PLAT_SPI_DescEncode and
+ * PLAT_SPI_DescTransaction, and the status polls, write enable and OP2 reads use descriptors built once per
+ * bus format instead of passing all the transaction parameters on every call.
+ * QLIB_SPI_DESC_PLAT_SIZE may be defined to the number of 32 bit words the platform pre-encoding requires.
+************************************************************************************************************/
+//#define QLIB_SPI_DESC_ENABLED
+//#define QLIB_SPI_DESC_PLAT_SIZE 4
+
+
+/************************************************************************************************************
+ * Enable SPI transaction lists. If defined, the platform implements PLAT_SPI_TransactionList, and a secure
+ * command is submitted to the platform as up to three ordered lists (exit QPI and OP1, OP0 polling, enter QPI
+ * and OP2), which a controller with a command queue can execute as one job each.
+************************************************************************************************************/
+//#define QLIB_SPI_LIST_ENABLED
+
+
+/************************************************************************************************************
+ * Enable continuous read mode of standard reads. If defined, the platform implements
+ * PLAT_SPI_ContinuousReadTransaction, and once enabled by QLIB_ContinuousRead_Enable, consecutive 1-2-2 and
+ * 1-4-4 fast reads keep the flash in continuous read mode, so the read instruction is sent only by the first read.
+************************************************************************************************************/
+//#define QLIB_STD_CONTINUOUS_READ_ENABLED
+
+
+/************************************************************************************************************
+ * Enable bus format auto-tuning. If defined, QLIB_InitDevice called with QLIB_BUS_FORMAT_AUTOTUNE tries the
+ * supported bus formats, with and without DTR, and the QPI read dummy cycles. Each candidate is validated by
+ * reading the pattern at QLIB_BUS_TUNE_ADDRESS and comparing it with a single SPI read, and the fastest candidate
+ * which passes is selected. The platform implements PLAT_GetTimeUs.
+ * QLIB_BUS_TUNE_ADDRESS may be defined to a logical address holding a non uniform pattern, and QLIB_BUS_TUNE_SIZE
+ * to the pattern size in bytes. QLIB_BUS_TUNE_ADDRESS must be plain readable, otherwise tuning is skipped.
+************************************************************************************************************/
+//#define QLIB_BUS_TUNE_ENABLED
+//#define QLIB_BUS_TUNE_ADDRESS 0
+//#define QLIB_BUS_TUNE_SIZE    64
+
+
+/************************************************************************************************************
+ * Enable SFDP (JESD216) discovery. If defined, QLIB_InitDevice reads the JEDEC basic flash parameter table of the
+ * device, and the erase types, typical erase and program times and supported fast read modes found there are used
+ * by the erase planner, the operation time model and the bus format auto-tuning instead of the compile-time values.
+************************************************************************************************************/
+//#define QLIB_STD_SFDP_ENABLED
+
+
+/************************************************************************************************************
+ * Enable the throughput report of the section scan utility QLIB_UTILS_ScanSection. If defined, the read and the
+ * CRC and digest calculation times are measured. The platform implements PLAT_GetTimeUs.
+************************************************************************************************************/
+//#define QLIB_UTILS_SCAN_STATS_ENABLED
+
+
+/************************************************************************************************************
+ * Enable the incremental integrity scrubber utility QLIB_UTILS_ScrubStart and QLIB_UTILS_ScrubStep. A section is
+ * verified in time slices, each bounded by a caller budget. The platform implements PLAT_GetTimeUs.
+************************************************************************************************************/
+//#define QLIB_UTILS_SCRUB_ENABLED
+
+
+/************************************************************************************************************
+ * Enable idle-time maintenance scheduling. If defined, QLIB_PerformMaintenanceIdle performs the monotonic counter
+ * maintenance needed according to the last SSR received, only as long as it fits in a caller idle window.
+ * The platform implements PLAT_GetTimeUs. QLIB_MAINT_SCHED_DEFAULT_US may be defined to the assumed maintenance
+ * iteration time until it is measured.
+************************************************************************************************************/
+//#define QLIB_MAINT_SCHED_ENABLED
+
+
+/************************************************************************************************************
+ * define QLIB_NOTIF_SSR_MAX_AGE_US to the maximal age, in microseconds, of the SSR cached by the last secure command
+ * which QLIB_GetNotifications and QLIB_PerformMaintenanceIdle use without reading the SSR. An older SSR is read again.
+ * If defined, the platform implements PLAT_GetTimeUs.
+************************************************************************************************************/
+//example for 100 milliseconds
+//#define QLIB_NOTIF_SSR_MAX_AGE_US 100000
+
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                         QLIB DEFINE OVERRIDES                                           */
@@ -125,6 +277,46 @@ void PLAT_HASH_Async_WaitWhileBusy(void);
 
 #endif //QLIB_HASH_OPTIMIZATION_ENABLED
 
+#ifdef QLIB_HASH_STREAM_ENABLED
+#ifndef PLAT_HASH_CTX_SIZE
+#define PLAT_HASH_CTX_SIZE 112
+#endif
+
+/************************************************************************************************************
+ * Streaming HASH state, the content is owned by the platform implementation.
+ * The default size fits a SHA-256 state, block buffer and length.
+************************************************************************************************************/
+typedef struct PLAT_HASH_CTX_T
+{
+    U32 state[(PLAT_HASH_CTX_SIZE + sizeof(U32) - 1) / sizeof(U32)]; ///< Platform hash state
+} PLAT_HASH_CTX_T;
+
+/************************************************************************************************************
+ * @brief The function starts a streaming HASH calculation
+ *
+ * @param[out]  ctx        Hash state
+************************************************************************************************************/
+void PLAT_HASH_Init(PLAT_HASH_CTX_T* ctx);
+
+/************************************************************************************************************
+ * @brief The function adds data to a streaming HASH calculation.
+ * The data may be split to chunks of any size, the result is the same as of a single PLAT_HASH call.
+ *
+ * @param[in,out]   ctx        Hash state
+ * @param[in]       data       Input data
+ * @param[in]       dataSize   Input data size in bytes
+************************************************************************************************************/
+void PLAT_HASH_Update(PLAT_HASH_CTX_T* ctx, const U8* data, U32 dataSize);
+
+/************************************************************************************************************
+ * @brief The function ends a streaming HASH calculation
+ *
+ * @param[in,out]   ctx        Hash state
+ * @param[out]      output     digest, same as PLAT_HASH output
+************************************************************************************************************/
+void PLAT_HASH_Final(PLAT_HASH_CTX_T* ctx, U32* output);
+#endif //QLIB_HASH_STREAM_ENABLED
+
 /************************************************************************************************************
  * @brief       This function returns non-repeating 'nonce' number.
  * A 'nonce' is a 64bit number that is used in session establishment.\n
@@ -192,6 +384,256 @@ void PLAT_SPI_MultiTransactionStop(void);
 
 #endif //QLIB_SPI_OPTIMIZATION_ENABLED
 
+#ifdef QLIB_SPI_ASYNC_ENABLED
+
+/************************************************************************************************************
+ * @brief       This routine starts SPI write-read transaction and returns without waiting for its completion.
+ * The parameters are identical to @ref PLAT_SPI_WriteReadTransaction. Only one asynchronous transaction is
+ * started at a time, and it is always completed by @ref PLAT_SPI_WriteReadTransaction_Async_Wait before any
+ * other transaction is started.\n
+ * @p dataOut and @p dataIn buffers remain valid until the transaction is completed.
+ * Interrupts are not disabled by Qlib while the transaction is in flight.
+ *
+ * @param[in,out]   userData        User data which is set using @ref QLIB_SetUserData
+ * @param[in]       format          SPI format
+ * @param[in]       dtr             DTR - Data is received and transmitted in both falling and rising edge of the CLK
+ * @param[in]       cmd             SPI command
+ * @param[in]       address         Command address
+ * @param[in]       addressSize     Size of the address in bytes
+ * @param[in]       dataOut         pointer to a buffer which holds the data to transmit
+ * @param[in]       dataOutSize     transmit data size in bytes
+ * @param[in]       dummyCycles     Dummy cycles between write and read phases
+ * @param[out]      dataIn          pointer to a buffer which holds the data received
+ * @param[in]       dataInSize      data received size in bytes
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                      - transaction started\n
+ * QLIB_STATUS__(ERROR)                     - Other error
+************************************************************************************************************/
+QLIB_STATUS_T PLAT_SPI_WriteReadTransaction_Async(const void*     userData,
+                                                  QLIB_BUS_MODE_T format,
+                                                  BOOL            dtr,
+                                                  U8              cmd,
+                                                  U32             address,
+                                                  U32             addressSize,
+                                                  const U8*       dataOut,
+                                                  U32             dataOutSize,
+                                                  U32             dummyCycles,
+                                                  U8*             dataIn,
+                                                  U32             dataInSize) __RAM_SECTION;
+
+/************************************************************************************************************
+ * @brief       This routine waits for the transaction started by @ref PLAT_SPI_WriteReadTransaction_Async to complete
+ *
+ * @param[in,out]   userData        User data which is set using @ref QLIB_SetUserData
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                      - no error occurred\n
+ * QLIB_STATUS__(ERROR)                     - Other error
+************************************************************************************************************/
+QLIB_STATUS_T PLAT_SPI_WriteReadTransaction_Async_Wait(const void* userData) __RAM_SECTION;
+
+#endif //QLIB_SPI_ASYNC_ENABLED
+
+#ifdef QLIB_PLAT_WAIT_ENABLED
+
+/************************************************************************************************************
+ * @brief       This routine waits between two status polls of a busy flash.
+ * The platform may use a timer, wait for an interrupt or yield to the OS, the next poll is issued once this
+ * function returns. The time it takes is returned to the application rather than spent on the bus.\n
+ * Interrupts are not masked by Qlib while the flash is busy, unless QLIB_SUPPORT_XIP is defined.
+ * No SPI transaction is in flight while this function is called.
+ *
+ * @param[in,out]   userData        User data which is set using @ref QLIB_SetUserData
+ * @param[in]       pollCount       Number of status polls which found the flash busy in the current wait, can be
+ *                                  used for back-off
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                      - continue polling\n
+ * QLIB_STATUS__(ERROR)                     - Stop waiting and return the error
+************************************************************************************************************/
+QLIB_STATUS_T PLAT_SPI_WaitWhileBusy(const void* userData, U32 pollCount) __RAM_SECTION;
+
+#endif //QLIB_PLAT_WAIT_ENABLED
+
+#if defined QLIB_OP_TIME_MODEL_SIZE || defined QLIB_IRQ_OFF_STATS_SIZE || defined QLIB_BUS_TUNE_ENABLED || \
+    defined QLIB_UTILS_SCAN_STATS_ENABLED || defined QLIB_UTILS_SCRUB_ENABLED || defined QLIB_MAINT_SCHED_ENABLED || \
+    defined QLIB_NOTIF_SSR_MAX_AGE_US || defined QLIB_PLAT_TIME_ENABLED
+
+/************************************************************************************************************
+ * @brief       This routine returns a free running time counter in microseconds.
+ * The counter may wrap around, only the difference between two readings is used.
+ * This function may be called while interrupts are masked.
+ *
+ * @return      Time in microseconds
+************************************************************************************************************/
+U32 PLAT_GetTimeUs(void) __RAM_SECTION;
+
+#endif //QLIB_OP_TIME_MODEL_SIZE || QLIB_IRQ_OFF_STATS_SIZE || QLIB_BUS_TUNE_ENABLED || QLIB_UTILS_SCAN_STATS_ENABLED || QLIB_UTILS_SCRUB_ENABLED || QLIB_MAINT_SCHED_ENABLED || QLIB_NOTIF_SSR_MAX_AGE_US || QLIB_PLAT_TIME_ENABLED
+
+#if defined QLIB_OP_TIME_MODEL_SIZE || defined QLIB_PLAT_TIME_ENABLED
+
+/************************************************************************************************************
+ * @brief       This routine waits at least the given time before the first status poll of a busy flash.
+ * The platform may use a timer, wait for an interrupt or yield to the OS.
+ * Interrupts are not masked by Qlib while the flash is busy, unless QLIB_SUPPORT_XIP is defined.
+ *
+ * @param[in,out]   userData        User data which is set using @ref QLIB_SetUserData
+ * @param[in]       delayUs         Time to wait in microseconds
+************************************************************************************************************/
+void PLAT_DelayUs(const void* userData, U32 delayUs) __RAM_SECTION;
+
+#endif //QLIB_OP_TIME_MODEL_SIZE || QLIB_PLAT_TIME_ENABLED
+
+#ifdef QLIB_SPI_DESC_ENABLED
+
+/************************************************************************************************************
+ * define QLIB_SPI_DESC_PLAT_SIZE to the number of 32 bit words the platform uses to pre-encode a transaction
+************************************************************************************************************/
+#ifndef QLIB_SPI_DESC_PLAT_SIZE
+#define QLIB_SPI_DESC_PLAT_SIZE 4
+#endif
+
+/************************************************************************************************************
+ * SPI transaction descriptor. Holds all the transaction parameters except of the address and data.
+ * Built by QLIB once per bus format, and never modified while it is in use.
+************************************************************************************************************/
+typedef struct QLIB_SPI_DESC_T
+{
+    QLIB_BUS_MODE_T format;                        ///< SPI format
+    BOOL            dtr;                           ///< DTR - Data is received and transmitted in both edges of the CLK
+    U8              cmd;                           ///< SPI command
+    U8              addressSize;                   ///< Size of the address in bytes
+    U8              dummyCycles;                   ///< Dummy cycles between write and read phases
+    U32             plat[QLIB_SPI_DESC_PLAT_SIZE]; ///< Platform pre-encoded transaction, set by PLAT_SPI_DescEncode
+} QLIB_SPI_DESC_T;
+
+/************************************************************************************************************
+ * @brief       This routine pre-encodes SPI transaction descriptor.
+ * Called by Qlib once the descriptor format, dtr, cmd, addressSize and dummyCycles fields are set, before the
+ * descriptor is first used. The platform stores the controller specific encoding of the transaction (e.g.
+ * controller register values) in the descriptor plat field, which is not modified later.
+ *
+ * @param[in,out]   userData        User data which is set using @ref QLIB_SetUserData
+ * @param[in,out]   desc            Transaction descriptor
+************************************************************************************************************/
+void PLAT_SPI_DescEncode(const void* userData, QLIB_SPI_DESC_T* desc);
+
+/************************************************************************************************************
+ * @brief       This routine performs SPI write-read transaction described by a descriptor pre-encoded with
+ * @ref PLAT_SPI_DescEncode.
+ * The transaction is identical to @ref PLAT_SPI_WriteReadTransaction with the descriptor parameters.
+ * This function should be linked to RAM memory.
+ *
+ * @param[in,out]   userData        User data which is set using @ref QLIB_SetUserData
+ * @param[in]       desc            Transaction descriptor
+ * @param[in]       address         Command address, used if the descriptor addressSize is not 0
+ * @param[in]       dataOut         pointer to a buffer which holds the data to transmit
+ * @param[in]       dataOutSize     transmit data size in bytes
+ * @param[out]      dataIn          pointer to a buffer which holds the data received
+ * @param[in]       dataInSize      data received size in bytes
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                      - no error occurred\n
+ * QLIB_STATUS__(ERROR)                     - Other error
+************************************************************************************************************/
+QLIB_STATUS_T PLAT_SPI_DescTransaction(const void*            userData,
+                                       const QLIB_SPI_DESC_T* desc,
+                                       U32                    address,
+                                       const U8*              dataOut,
+                                       U32                    dataOutSize,
+                                       U8*                    dataIn,
+                                       U32                    dataInSize) __RAM_SECTION;
+
+#endif //QLIB_SPI_DESC_ENABLED
+
+#ifdef QLIB_SPI_LIST_ENABLED
+
+/************************************************************************************************************
+ * SPI transaction list entry, executed by @ref PLAT_SPI_TransactionList.
+ * The status of a transaction is the first 4 bytes of its dataIn, read as U32 in the CPU byte order.
+************************************************************************************************************/
+typedef struct QLIB_SPI_TRANSACTION_T
+{
+    QLIB_BUS_MODE_T format;          ///< SPI format
+    BOOL            dtr;             ///< DTR - Data is received and transmitted in both edges of the CLK
+    U8              cmd;             ///< SPI command
+    U32             address;         ///< Command address
+    U32             addressSize;     ///< Size of the address in bytes
+    const U8*       dataOut;         ///< Data to transmit
+    U32             dataOutSize;     ///< Transmit data size in bytes
+    U32             dummyCycles;     ///< Dummy cycles between write and read phases
+    U8*             dataIn;          ///< Buffer for the data received
+    U32             dataInSize;      ///< Received data size in bytes
+    U32             repeatWhileMask; ///< If not 0, the transaction is repeated while its status has one of these bits set
+    U32             repeatUntilMask; ///< Repeat stops once the status has one of these bits set
+} QLIB_SPI_TRANSACTION_T;
+
+/************************************************************************************************************
+ * @brief       This routine performs an ordered list of SPI transactions.
+ * Each transaction is identical to @ref PLAT_SPI_WriteReadTransaction with the entry parameters, and is
+ * executed after the previous one is completed. An entry with repeatWhileMask set is repeated while
+ * (status & repeatWhileMask) != 0 and (status & repeatUntilMask) == 0, where status is the first 32 bits of
+ * the entry received data. The platform may wait between the repeats (see PLAT_SPI_WaitWhileBusy).\n
+ * Lists which toggle QPI or access the IBUF/OBUF are executed with interrupts masked. The OP0 polling list is
+ * executed with interrupts enabled, unless QLIB_SUPPORT_XIP is defined.
+ * This function should be linked to RAM memory.
+ *
+ * @param[in,out]   userData        User data which is set using @ref QLIB_SetUserData
+ * @param[in]       list            Transactions
+ * @param[in]       count           Number of transactions
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                      - no error occurred\n
+ * QLIB_STATUS__(ERROR)                     - Other error, the rest of the list is not executed
+************************************************************************************************************/
+QLIB_STATUS_T PLAT_SPI_TransactionList(const void* userData, const QLIB_SPI_TRANSACTION_T* list, U32 count) __RAM_SECTION;
+
+#endif //QLIB_SPI_LIST_ENABLED
+
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+
+/************************************************************************************************************
+ * @brief       This routine performs SPI read transaction without the instruction phase.
+ * Used while the flash is in continuous read mode, the transaction starts with the address phase in @p format.
+ * The continuous read mode bits (M7-0) are sent as the last byte of @p address, and @p dummyCycles does not
+ * include them.\n
+ * The waveform is identical to @ref PLAT_SPI_WriteReadTransaction with the instruction phase omitted.
+ * This function should be linked to RAM memory.
+ *
+ * @param[in,out]   userData        User data which is set using @ref QLIB_SetUserData
+ * @param[in]       format          SPI format, QLIB_BUS_MODE_1_2_2 or QLIB_BUS_MODE_1_4_4
+ * @param[in]       dtr             DTR - Data is received and transmitted in both falling and rising edge of the CLK
+ * @param[in]       address         Command address followed by the mode bits
+ * @param[in]       addressSize     Size of the address in bytes, including the mode bits
+ * @param[in]       dummyCycles     Dummy cycles between address and read phases
+ * @param[out]      dataIn          pointer to a buffer which holds the data received
+ * @param[in]       dataInSize      data received size in bytes
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                      - no error occurred\n
+ * QLIB_STATUS__(ERROR)                     - Other error
+************************************************************************************************************/
+QLIB_STATUS_T PLAT_SPI_ContinuousReadTransaction(const void*     userData,
+                                                 QLIB_BUS_MODE_T format,
+                                                 BOOL            dtr,
+                                                 U32             address,
+                                                 U32             addressSize,
+                                                 U32             dummyCycles,
+                                                 U8*             dataIn,
+                                                 U32             dataInSize) __RAM_SECTION;
+
+#endif //QLIB_STD_CONTINUOUS_READ_ENABLED
+
+#ifdef QLIB_BUS_TUNE_ENABLED
+#ifndef QLIB_BUS_TUNE_ADDRESS
+#define QLIB_BUS_TUNE_ADDRESS 0
+#endif
+#ifndef QLIB_BUS_TUNE_SIZE
+#define QLIB_BUS_TUNE_SIZE 64
+#endif
+#endif //QLIB_BUS_TUNE_ENABLED
+
 #ifdef __cplusplus
 }
 #endif
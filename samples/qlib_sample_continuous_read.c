@@ -0,0 +1,133 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_sample_continuous_read.c
+* @brief      This file contains QLIB continuous read mode sample implementation
+*
+* @example    qlib_sample_continuous_read.c
+*
+* @page       continuous_read continuous read mode sample code
+* This sample code measures the throughput of small random plain reads, with and without the continuous read
+* mode. The time is measured with the platform time functions (QLIB_PLAT_TIME_ENABLED). In continuous read mode only the first read sends the 8 cycles instruction, so
+* the gain is the largest for small reads.
+*
+* @include    samples/qlib_sample_continuous_read.c
+*
+************************************************************************************************************/
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                                  INCLUDES
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+#include "qlib.h"
+#include "qlib_sample_continuous_read.h"
+
+#if defined QLIB_STD_CONTINUOUS_READ_ENABLED && defined QLIB_PLAT_TIME_ENABLED
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                                DEFINITIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+#define QLIB_SAMPLE_CONTINUOUS_READ_MAX_SIZE 256
+#define QLIB_SAMPLE_CONTINUOUS_READ_SEED     0x12345678
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                              LOCAL VARIABLES
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+static U8 readBuf[QLIB_SAMPLE_CONTINUOUS_READ_MAX_SIZE];
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                        LOCAL FUNCTION DECLARATIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+static QLIB_STATUS_T QLIB_SAMPLE_ContinuousReadRun_L(QLIB_CONTEXT_T* qlibContext,
+                                                     U32             sectionID,
+                                                     U32             sectionSize,
+                                                     U32             readSize,
+                                                     U32             readCount,
+                                                     U32*            totalUs);
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                             INTERFACE FUNCTIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+
+QLIB_STATUS_T QLIB_SAMPLE_ContinuousReadMeasure(QLIB_CONTEXT_T* qlibContext,
+                                                U32             sectionID,
+                                                U32             sectionSize,
+                                                U32             readSize,
+                                                U32             readCount,
+                                                U32*            continuousUs,
+                                                U32*            normalUs)
+{
+    QLIB_STATUS_T ret = QLIB_STATUS__OK;
+
+    QLIB_ASSERT_RET(NULL != continuousUs && NULL != normalUs, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 != readSize && QLIB_SAMPLE_CONTINUOUS_READ_MAX_SIZE >= readSize, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 != readCount && readSize <= sectionSize, QLIB_STATUS__INVALID_PARAMETER);
+
+    /*-------------------------------------------------------------------------------------------------------
+     Same offsets in both modes, only the instruction phase differs
+    -------------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(QLIB_ContinuousRead_Enable(qlibContext, TRUE));
+    ret = QLIB_SAMPLE_ContinuousReadRun_L(qlibContext, sectionID, sectionSize, readSize, readCount, continuousUs);
+
+    QLIB_STATUS_RET_CHECK(QLIB_ContinuousRead_Enable(qlibContext, FALSE));
+    QLIB_STATUS_RET_CHECK(ret);
+    QLIB_STATUS_RET_CHECK(
+        QLIB_SAMPLE_ContinuousReadRun_L(qlibContext, sectionID, sectionSize, readSize, readCount, normalUs));
+
+    QLIB_DEBUG_PRINT(QLIB_VERBOSE_INFO,
+                     "%u random reads of %u bytes: normal %u ns per read (%u KB/s), continuous %u ns per read (%u KB/s)",
+                     (unsigned int)readCount,
+                     (unsigned int)readSize,
+                     (unsigned int)(((U64)*normalUs * 1000) / readCount),
+                     (unsigned int)((0 != *normalUs) ? ((U64)readSize * readCount * 1000) / *normalUs : 0),
+                     (unsigned int)(((U64)*continuousUs * 1000) / readCount),
+                     (unsigned int)((0 != *continuousUs) ? ((U64)readSize * readCount * 1000) / *continuousUs : 0));
+
+    return QLIB_STATUS__OK;
+}
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                              LOCAL FUNCTIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+
+static QLIB_STATUS_T QLIB_SAMPLE_ContinuousReadRun_L(QLIB_CONTEXT_T* qlibContext,
+                                                     U32             sectionID,
+                                                     U32             sectionSize,
+                                                     U32             readSize,
+                                                     U32             readCount,
+                                                     U32*            totalUs)
+{
+    U32 seed  = QLIB_SAMPLE_CONTINUOUS_READ_SEED;
+    U32 start = 0;
+    U32 i;
+
+    start = PLAT_GetTimeUs();
+    for (i = 0; i < readCount; i++)
+    {
+        /*---------------------------------------------------------------------------------------------------
+         Pseudo-random offset (LCG), so the reads do not benefit from sequential prefetch
+        ---------------------------------------------------------------------------------------------------*/
+        seed = (seed * 1103515245u) + 12345u;
+        QLIB_STATUS_RET_CHECK(
+            QLIB_Read(qlibContext, readBuf, sectionID, (seed >> 8) % (sectionSize - readSize + 1), readSize, FALSE, FALSE));
+    }
+    *totalUs = PLAT_GetTimeUs() - start;
+
+    return QLIB_STATUS__OK;
+}
+
+#endif // QLIB_STD_CONTINUOUS_READ_ENABLED && QLIB_PLAT_TIME_ENABLED
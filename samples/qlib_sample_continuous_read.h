@@ -0,0 +1,48 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_sample_continuous_read.h
+* @brief      This file contains QLIB continuous read mode sample definitions
+*
+* ### project qlib_samples
+*
+************************************************************************************************************/
+
+#ifndef _QLIB_SAMPLE_CONTINUOUS_READ__H_
+#define _QLIB_SAMPLE_CONTINUOUS_READ__H_
+
+#if defined QLIB_STD_CONTINUOUS_READ_ENABLED && defined QLIB_PLAT_TIME_ENABLED
+
+/************************************************************************************************************
+ * @brief       This routine compares the throughput of small random plain reads with and without the
+ *              continuous read mode.
+ *              It performs @p readCount reads of @p readSize bytes from pseudo-random offsets of the section,
+ *              once in each mode with the same offsets, and prints the time per read and the throughput.
+ *              The continuous read mode is left disabled, its default.
+ *              This function assumes the QLIB library and flash device are already initialized, the section
+ *              is accessible for plain read and the bus format uses dual or quad I/O fast read.
+ *
+ * @param[out]  qlibContext     [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   sectionID       [Section index](md_definitions.html#DEF_SECTION)
+ * @param[in]   sectionSize     Size of the section in bytes, the reads are within this range
+ * @param[in]   readSize        [Size](md_definitions.html#DEF_SIZE) of each read
+ * @param[in]   readCount       Number of reads in each mode
+ * @param[out]  continuousUs    Total reads time in continuous read mode, in microseconds
+ * @param[out]  normalUs        Total reads time without continuous read mode, in microseconds
+ *
+ * @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SAMPLE_ContinuousReadMeasure(QLIB_CONTEXT_T* qlibContext,
+                                                U32             sectionID,
+                                                U32             sectionSize,
+                                                U32             readSize,
+                                                U32             readCount,
+                                                U32*            continuousUs,
+                                                U32*            normalUs);
+
+#endif // QLIB_STD_CONTINUOUS_READ_ENABLED && QLIB_PLAT_TIME_ENABLED
+
+#endif // _QLIB_SAMPLE_CONTINUOUS_READ__H_
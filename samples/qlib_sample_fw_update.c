@@ -41,6 +41,13 @@ static QLIB_STATUS_T QLIB_SAMPLE_SecCompare_L(QLIB_CONTEXT_T* qlibContext,
                                               U32             sectionOffset,
                                               BOOL            secure,
                                               BOOL            auth);
+#ifdef QLIB_SAMPLE_VERIFY_BY_DIGEST
+static QLIB_STATUS_T QLIB_SAMPLE_DigestCompare_L(QLIB_CONTEXT_T* qlibContext,
+                                                 const U8*       fw,
+                                                 U32             fw_size,
+                                                 U32             section,
+                                                 const U64*      fwDigest);
+#endif
 
 /*-----------------------------------------------------------------------------------------------------------
 -------------------------------------------------------------------------------------------------------------
@@ -183,9 +190,38 @@ QLIB_STATUS_T QLIB_SAMPLE_FirmwareUpdate(QLIB_CONTEXT_T* qlibContext,
     -------------------------------------------------------------------------------------------------------*/
     if (swap == QLIB_SWAP)
     {
+#ifdef QLIB_SAMPLE_VERIFY_BY_DIGEST
+        /*---------------------------------------------------------------------------------------------------
+         Compare the section digest calculated by the device with the FW digest. The active half is read back
+         only if the digests mismatch, to locate the bad blocks, or if the FW digest is not available.
+        ---------------------------------------------------------------------------------------------------*/
+        ret = QLIB_SAMPLE_DigestCompare_L(qlibContext, (const U8*)fw, fw_size, section, checkDigest);
+        if (QLIB_STATUS__SECURITY_ERR == ret)
+        {
+            QLIB_STATUS_T readBackRet =
+                QLIB_SAMPLE_SecCompare_L(qlibContext, (const U8*)fw, fw_size, section, 0, TRUE, TRUE);
+
+            /*-----------------------------------------------------------------------------------------------
+             Report both results, a read-back failure takes precedence over the digest mismatch
+            -----------------------------------------------------------------------------------------------*/
+            QLIB_DEBUG_PRINT(QLIB_VERBOSE_ERROR,
+                             "Section %d digest mismatch, read-back compare status %d\r\n",
+                             section,
+                             readBackRet);
+            if (QLIB_STATUS__OK != readBackRet)
+            {
+                ret = readBackRet;
+            }
+        }
+        else if (QLIB_STATUS__NOT_SUPPORTED == ret)
+        {
+            ret = QLIB_SAMPLE_SecCompare_L(qlibContext, (const U8*)fw, fw_size, section, 0, TRUE, TRUE);
+        }
+#else
         QLIB_STATUS_RET_CHECK_GOTO(QLIB_SAMPLE_SecCompare_L(qlibContext, (const U8*)fw, fw_size, section, 0, TRUE, TRUE),
                                    ret,
                                    disconnect);
+#endif
     }
 
 disconnect:
@@ -367,7 +403,8 @@ close_session:
  * @param[in]   secure          If read is secure
  * @param[in]   auth            If read is authenticated
  *
- * @return      0 if fw[fw size] is equal to flash content from section[sectionOffset]
+ * @return      0 if fw[fw size] is equal to flash content from section[sectionOffset]. The compare continues
+ *              after a mismatch, and the offset of every mismatching block is printed.
 ************************************************************************************************************/
 static QLIB_STATUS_T QLIB_SAMPLE_SecCompare_L(QLIB_CONTEXT_T* qlibContext,
                                               const U8*       fw,
@@ -378,6 +415,7 @@ static QLIB_STATUS_T QLIB_SAMPLE_SecCompare_L(QLIB_CONTEXT_T* qlibContext,
                                               BOOL            auth)
 {
     QLIB_STATUS_T ret      = QLIB_STATUS__OK;
+    QLIB_STATUS_T cmpRet   = QLIB_STATUS__OK;
     U32           compared = 0;
     U32           takeSize = 0;
     U32           take[4];
@@ -387,18 +425,90 @@ static QLIB_STATUS_T QLIB_SAMPLE_SecCompare_L(QLIB_CONTEXT_T* qlibContext,
     while (compared < fw_size)
     {
         takeSize = MIN(fw_size - compared, sizeof(take));
-        QLIB_STATUS_RET_CHECK_GOTO(QLIB_Read(qlibContext, (U8*)take, section, sectionOffset, takeSize, secure, auth),
+        QLIB_STATUS_RET_CHECK_GOTO(QLIB_Read(qlibContext, (U8*)take, section, sectionOffset + compared, takeSize, secure, auth),
                                    ret,
                                    close_session);
-        QLIB_ASSERT_WITH_ERROR_GOTO(0 == memcmp(&fw[compared], (U8*)take, takeSize),
-                                    QLIB_STATUS__COMMAND_FAIL,
-                                    ret,
-                                    close_session);
+        if (0 != memcmp(&fw[compared], (U8*)take, takeSize))
+        {
+            QLIB_DEBUG_PRINT(QLIB_VERBOSE_ERROR, "Mismatch at section %d offset 0x%x\r\n", section, sectionOffset + compared);
+            cmpRet = QLIB_STATUS__COMMAND_FAIL;
+        }
         compared += takeSize;
     }
 
+    ret = cmpRet;
+
+close_session:
+
+    (void)QLIB_CloseSession(qlibContext, section);
+    return ret;
+}
+
+#ifdef QLIB_SAMPLE_VERIFY_BY_DIGEST
+/************************************************************************************************************
+ * @brief       This routine compares the digest of the active half of a section, calculated by the device,
+ *              with the FW digest. The FW digest is calculated over the FW padded with erased data to the half
+ *              section size, if it is not given.
+ *
+ * @param[out]  qlibContext     [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   fw              FW buffer
+ * @param[in]   fw_size         FW buffer size in bytes
+ * @param[in]   section         [Section index](md_definitions.html#DEF_SECTION)
+ * @param[in]   fwDigest        FW digest, if NULL it is calculated
+ *
+ * @return      0 if the digests are equal, QLIB_STATUS__SECURITY_ERR if they mismatch,
+ *              QLIB_STATUS__NOT_SUPPORTED if the FW digest can not be calculated
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_SAMPLE_DigestCompare_L(QLIB_CONTEXT_T* qlibContext,
+                                                 const U8*       fw,
+                                                 U32             fw_size,
+                                                 U32             section,
+                                                 const U64*      fwDigest)
+{
+    QLIB_STATUS_T ret          = QLIB_STATUS__OK;
+    U64           hostDigest   = 0;
+    U64           deviceDigest = 0;
+
+    QLIB_STATUS_RET_CHECK(QLIB_OpenSession(qlibContext, section, QLIB_SESSION_ACCESS_FULL));
+
+    if (NULL != fwDigest)
+    {
+        hostDigest = *fwDigest;
+    }
+    else
+    {
+#ifdef QLIB_HASH_STREAM_ENABLED
+        QLIB_UTILS_DIGEST_CTX_T digestCtx;
+        U32                     sectionLen;
+
+        QLIB_STATUS_RET_CHECK_GOTO(
+            QLIB_GetSectionConfiguration(qlibContext, section, NULL, &sectionLen, NULL, NULL, NULL, NULL),
+            ret,
+            close_session);
+        QLIB_ASSERT_WITH_ERROR_GOTO(0 == (fw_size % sizeof(U32)), QLIB_STATUS__NOT_SUPPORTED, ret, close_session);
+
+        QLIB_STATUS_RET_CHECK_GOTO(QLIB_UTILS_DigestInit(&digestCtx), ret, close_session);
+        QLIB_STATUS_RET_CHECK_GOTO(QLIB_UTILS_DigestUpdate(&digestCtx, fw, fw_size), ret, close_session);
+        QLIB_STATUS_RET_CHECK_GOTO(QLIB_UTILS_DigestUpdatePadding(&digestCtx, 0xFFFFFFFF, (sectionLen / 2) - fw_size),
+                                   ret,
+                                   close_session);
+        QLIB_STATUS_RET_CHECK_GOTO(QLIB_UTILS_DigestFinal(&digestCtx, &hostDigest), ret, close_session);
+#else
+        TOUCH(fw);
+        TOUCH(fw_size);
+        QLIB_ASSERT_WITH_ERROR_GOTO(FALSE, QLIB_STATUS__NOT_SUPPORTED, ret, close_session);
+#endif
+    }
+
+    /*-------------------------------------------------------------------------------------------------------
+     A single secure command returns the digest of the active half
+    -------------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_CalcSectionDigest(qlibContext, section, &deviceDigest), ret, close_session);
+    QLIB_ASSERT_WITH_ERROR_GOTO(hostDigest == deviceDigest, QLIB_STATUS__SECURITY_ERR, ret, close_session);
+
 close_session:
 
     (void)QLIB_CloseSession(qlibContext, section);
     return ret;
 }
+#endif // QLIB_SAMPLE_VERIFY_BY_DIGEST
@@ -21,6 +21,8 @@
 
 #define QLIB_SAMPLE_MAX_FW_SIZE (QLIB_SAMPLE_SECTION_SIZE / 2) // two halves ( active and not active )
 
+//#define QLIB_SAMPLE_VERIFY_BY_DIGEST // verify by device section digest instead of read-back compare
+
 #define FW_UPDATE_DEMO_DATA_SECTION_NUM 3
 #define FW_UPDATE_DEMO_CODE_SECTION_NUM 0
 
@@ -0,0 +1,85 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_sample_spi_async.c
+* @brief      This file contains QLIB asynchronous SPI sample implementation
+*
+* @example    qlib_sample_spi_async.c
+*
+* @page       spi_async asynchronous SPI sample code
+* This sample code measures the throughput of multi-page secure reads with the asynchronous SPI platform
+* functions, which are implemented by the platform (typically with SPI DMA). The next cipher key is built while
+* the current page is transferred on the bus. The time is measured with the platform time functions
+* (QLIB_PLAT_TIME_ENABLED).
+*
+* @include    samples/qlib_sample_spi_async.c
+*
+************************************************************************************************************/
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                                  INCLUDES
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+#include "qlib.h"
+#include "qlib_sample_spi_async.h"
+
+#if defined QLIB_SPI_ASYNC_ENABLED && defined QLIB_PLAT_TIME_ENABLED
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                                DEFINITIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+#define QLIB_SAMPLE_SPI_ASYNC_READ_CHUNK _4KB_
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                              LOCAL VARIABLES
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+static U32 readBuf[QLIB_SAMPLE_SPI_ASYNC_READ_CHUNK / sizeof(U32)];
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                             INTERFACE FUNCTIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+
+QLIB_STATUS_T QLIB_SAMPLE_SpiAsyncMeasure(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U32 size, U32* totalUs)
+{
+    U32 offset    = 0;
+    U32 chunkSize = 0;
+    U32 start     = 0;
+
+    QLIB_ASSERT_RET(NULL != totalUs, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 != size, QLIB_STATUS__INVALID_PARAMETER);
+
+    /*-------------------------------------------------------------------------------------------------------
+     Aligned secure read, so the multi-page pipeline is used
+    -------------------------------------------------------------------------------------------------------*/
+    start = PLAT_GetTimeUs();
+    while (offset < size)
+    {
+        chunkSize = MIN(size - offset, QLIB_SAMPLE_SPI_ASYNC_READ_CHUNK);
+        QLIB_STATUS_RET_CHECK(QLIB_Read(qlibContext, (U8*)readBuf, sectionID, offset, chunkSize, TRUE, FALSE));
+        offset += chunkSize;
+    }
+    *totalUs = PLAT_GetTimeUs() - start;
+
+    /*-------------------------------------------------------------------------------------------------------
+     Compare with the same read on a build without QLIB_SPI_ASYNC_ENABLED to get the overlapped time
+    -------------------------------------------------------------------------------------------------------*/
+    QLIB_DEBUG_PRINT(QLIB_VERBOSE_INFO,
+                     "Secure read of %u bytes: total %u us (%u KB/s)",
+                     (unsigned int)size,
+                     (unsigned int)*totalUs,
+                     (unsigned int)((0 != *totalUs) ? ((U64)size * 1000) / *totalUs : 0));
+
+    return QLIB_STATUS__OK;
+}
+
+#endif // QLIB_SPI_ASYNC_ENABLED && QLIB_PLAT_TIME_ENABLED
@@ -0,0 +1,38 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_sample_spi_async.h
+* @brief      This file contains QLIB asynchronous SPI sample definitions
+*
+* ### project qlib_samples
+*
+************************************************************************************************************/
+
+#ifndef _QLIB_SAMPLE_SPI_ASYNC__H_
+#define _QLIB_SAMPLE_SPI_ASYNC__H_
+
+#if defined QLIB_SPI_ASYNC_ENABLED && defined QLIB_PLAT_TIME_ENABLED
+
+/************************************************************************************************************
+ * @brief       This routine measures the secure read time with asynchronous SPI transactions.
+ *              It performs secure read of @p size bytes from the beginning of the section and prints the
+ *              read time and the throughput. The asynchronous SPI transactions are executed by the platform
+ *              PLAT_SPI_WriteReadTransaction_Async and PLAT_SPI_WriteReadTransaction_Async_Wait functions.
+ *              This function assumes the QLIB library and flash device are already initialized and a session
+ *              to the section is open.
+ *
+ * @param[out]  qlibContext     [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   sectionID       [Section index](md_definitions.html#DEF_SECTION)
+ * @param[in]   size            [Size](md_definitions.html#DEF_SIZE) to read
+ * @param[out]  totalUs         Total read time, in microseconds
+ *
+ * @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SAMPLE_SpiAsyncMeasure(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U32 size, U32* totalUs);
+
+#endif // QLIB_SPI_ASYNC_ENABLED && QLIB_PLAT_TIME_ENABLED
+
+#endif // _QLIB_SAMPLE_SPI_ASYNC__H_
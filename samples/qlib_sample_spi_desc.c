@@ -0,0 +1,130 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_sample_spi_desc.c
+* @brief      This file contains QLIB SPI transaction descriptors sample implementation
+*
+* @example    qlib_sample_spi_desc.c
+*
+* @page       spi_desc SPI transaction descriptors sample code
+* This sample code shows a generic implementation of the SPI transaction descriptor platform functions on top
+* of PLAT_SPI_WriteReadTransaction. A controller specific implementation stores its register values in the
+* descriptor instead of the packed header used here.
+*
+* @include    samples/qlib_sample_spi_desc.c
+*
+************************************************************************************************************/
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                                  INCLUDES
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+#include "qlib.h"
+#include "qlib_sample_spi_desc.h"
+
+#ifdef QLIB_SPI_DESC_ENABLED
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                                DEFINITIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+// Pre-encoded header: plat[0] holds the command, format, DTR and dummy cycles, plat[1] holds the address size
+#define QLIB_SAMPLE_SPI_DESC_HEADER(desc) \
+    MAKE_32_BIT((desc)->cmd, (U8)(desc)->format, (U8)(desc)->dtr, (desc)->dummyCycles)
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                              LOCAL VARIABLES
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+static U32 encodeCountTotal;
+static U32 transactionCountTotal;
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                       PLATFORM FUNCTIONS IMPLEMENTATION
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+
+void PLAT_SPI_DescEncode(const void* userData, QLIB_SPI_DESC_T* desc)
+{
+    (void)userData;
+
+    desc->plat[0] = QLIB_SAMPLE_SPI_DESC_HEADER(desc);
+    desc->plat[1] = desc->addressSize;
+    encodeCountTotal++;
+}
+
+QLIB_STATUS_T PLAT_SPI_DescTransaction(const void*            userData,
+                                       const QLIB_SPI_DESC_T* desc,
+                                       U32                    address,
+                                       const U8*              dataOut,
+                                       U32                    dataOutSize,
+                                       U8*                    dataIn,
+                                       U32                    dataInSize)
+{
+    U32 header = desc->plat[0];
+
+    transactionCountTotal++;
+
+    /*-------------------------------------------------------------------------------------------------------
+     Only the pre-encoded words are used, the descriptor fields are not parsed again
+    -------------------------------------------------------------------------------------------------------*/
+    return PLAT_SPI_WriteReadTransaction(userData,
+                                         (QLIB_BUS_MODE_T)(U8)(header >> 8),
+                                         (BOOL)(U8)(header >> 16),
+                                         (U8)header,
+                                         address,
+                                         desc->plat[1],
+                                         dataOut,
+                                         dataOutSize,
+                                         header >> 24,
+                                         dataIn,
+                                         dataInSize);
+}
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                             INTERFACE FUNCTIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+
+void QLIB_SAMPLE_SpiDescGetStats(U32* encodeCount, U32* transactionCount)
+{
+    *encodeCount      = encodeCountTotal;
+    *transactionCount = transactionCountTotal;
+}
+
+QLIB_STATUS_T QLIB_SAMPLE_SpiDescMeasureErase(QLIB_CONTEXT_T* qlibContext,
+                                              U32             sectionID,
+                                              U32             offset,
+                                              U32             sectorCount,
+                                              BOOL            secure)
+{
+    U32 encodeStart      = encodeCountTotal;
+    U32 transactionStart = transactionCountTotal;
+
+    QLIB_ASSERT_RET(0 != sectorCount, QLIB_STATUS__INVALID_PARAMETER);
+
+    QLIB_STATUS_RET_CHECK(QLIB_Erase(qlibContext, sectionID, offset, sectorCount * FLASH_SECTOR_SIZE, secure));
+
+    /*-------------------------------------------------------------------------------------------------------
+     The status polls of all the erased sectors reuse the descriptors encoded for the current bus format
+    -------------------------------------------------------------------------------------------------------*/
+    QLIB_DEBUG_PRINT(QLIB_VERBOSE_INFO,
+                     "Erase of %u sectors: %u descriptor transactions, %u descriptors encoded",
+                     (unsigned int)sectorCount,
+                     (unsigned int)(transactionCountTotal - transactionStart),
+                     (unsigned int)(encodeCountTotal - encodeStart));
+    (void)encodeStart;
+    (void)transactionStart;
+
+    return QLIB_STATUS__OK;
+}
+
+#endif // QLIB_SPI_DESC_ENABLED
@@ -0,0 +1,49 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_sample_spi_desc.h
+* @brief      This file contains QLIB SPI transaction descriptors sample definitions
+*
+* ### project qlib_samples
+*
+************************************************************************************************************/
+
+#ifndef _QLIB_SAMPLE_SPI_DESC__H_
+#define _QLIB_SAMPLE_SPI_DESC__H_
+
+#ifdef QLIB_SPI_DESC_ENABLED
+
+/************************************************************************************************************
+ * @brief       This routine returns the statistics of the SPI transaction descriptors
+ *
+ * @param[out]  encodeCount        Number of descriptors encoded
+ * @param[out]  transactionCount   Number of transactions executed using descriptors
+************************************************************************************************************/
+void QLIB_SAMPLE_SpiDescGetStats(U32* encodeCount, U32* transactionCount);
+
+/************************************************************************************************************
+ * @brief       This routine erases @p sectorCount sectors from @p offset and prints the number of transactions
+ *              executed with pre-encoded descriptors against the number of descriptors encoded.
+ *              This function assumes the QLIB library and flash device are already initialized and the section
+ *              is accessible for erase.
+ *
+ * @param[out]  qlibContext     [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   sectionID       [Section index](md_definitions.html#DEF_SECTION)
+ * @param[in]   offset          [Section offset](md_definitions.html#DEF_OFFSET), aligned to FLASH_SECTOR_SIZE
+ * @param[in]   sectorCount     Number of sectors to erase
+ * @param[in]   secure          if TRUE, secure erase is performed
+ *
+ * @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SAMPLE_SpiDescMeasureErase(QLIB_CONTEXT_T* qlibContext,
+                                              U32             sectionID,
+                                              U32             offset,
+                                              U32             sectorCount,
+                                              BOOL            secure);
+
+#endif // QLIB_SPI_DESC_ENABLED
+
+#endif // _QLIB_SAMPLE_SPI_DESC__H_
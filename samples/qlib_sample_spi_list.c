@@ -0,0 +1,140 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_sample_spi_list.c
+* @brief      This file contains QLIB SPI transaction list sample implementation
+*
+* @example    qlib_sample_spi_list.c
+*
+* @page       spi_list SPI transaction list sample code
+* This sample code shows a generic implementation of the SPI transaction list platform function on top of
+* PLAT_SPI_WriteReadTransaction. A controller with a command queue would instead load the whole list and
+* execute it as one job, evaluating the repeat and condition masks in hardware.
+*
+* @include    samples/qlib_sample_spi_list.c
+*
+************************************************************************************************************/
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                                  INCLUDES
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+#include "qlib.h"
+#include "qlib_sample_spi_list.h"
+
+#ifdef QLIB_SPI_LIST_ENABLED
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                                DEFINITIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+#define QLIB_SAMPLE_SPI_LIST_READ_SIZE _4KB_
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                              LOCAL VARIABLES
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+static U32 listCountTotal;
+static U32 transactionCountTotal;
+static U32 readBuf[QLIB_SAMPLE_SPI_LIST_READ_SIZE / sizeof(U32)];
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                       PLATFORM FUNCTIONS IMPLEMENTATION
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+
+QLIB_STATUS_T PLAT_SPI_TransactionList(const void* userData, const QLIB_SPI_TRANSACTION_T* list, U32 count)
+{
+    const QLIB_SPI_TRANSACTION_T* entry  = NULL;
+    U32                           status = 0;
+    U32                           i;
+#ifdef QLIB_PLAT_WAIT_ENABLED
+    U32 pollCount = 0;
+#endif
+
+    listCountTotal++;
+
+    for (i = 0; i < count; i++)
+    {
+        entry = &list[i];
+
+        while (TRUE)
+        {
+            QLIB_STATUS_RET_CHECK(PLAT_SPI_WriteReadTransaction(userData,
+                                                                entry->format,
+                                                                entry->dtr,
+                                                                entry->cmd,
+                                                                entry->address,
+                                                                entry->addressSize,
+                                                                entry->dataOut,
+                                                                entry->dataOutSize,
+                                                                entry->dummyCycles,
+                                                                entry->dataIn,
+                                                                entry->dataInSize));
+            transactionCountTotal++;
+
+            if (0 == entry->repeatWhileMask)
+            {
+                break;
+            }
+
+            /*-----------------------------------------------------------------------------------------------
+             Repeated transaction, continue while the status matches
+            -----------------------------------------------------------------------------------------------*/
+            memcpy(&status, entry->dataIn, sizeof(U32));
+            if (0 == (status & entry->repeatWhileMask) || 0 != (status & entry->repeatUntilMask))
+            {
+                break;
+            }
+#ifdef QLIB_PLAT_WAIT_ENABLED
+            QLIB_STATUS_RET_CHECK(PLAT_SPI_WaitWhileBusy(userData, pollCount++));
+#endif
+        }
+    }
+
+    return QLIB_STATUS__OK;
+}
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                             INTERFACE FUNCTIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+
+void QLIB_SAMPLE_SpiListGetStats(U32* listCount, U32* transactionCount)
+{
+    *listCount        = listCountTotal;
+    *transactionCount = transactionCountTotal;
+}
+
+QLIB_STATUS_T QLIB_SAMPLE_SpiListMeasureRead(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U32 size)
+{
+    U32 listStart        = listCountTotal;
+    U32 transactionStart = transactionCountTotal;
+
+    QLIB_ASSERT_RET(size <= QLIB_SAMPLE_SPI_LIST_READ_SIZE, QLIB_STATUS__INVALID_PARAMETER);
+
+    QLIB_STATUS_RET_CHECK(QLIB_Read(qlibContext, (U8*)readBuf, sectionID, 0, size, TRUE, FALSE));
+
+    /*-------------------------------------------------------------------------------------------------------
+     Every secure command crosses the platform boundary up to three times, whatever the number of polls it takes
+    -------------------------------------------------------------------------------------------------------*/
+    QLIB_DEBUG_PRINT(QLIB_VERBOSE_INFO,
+                     "Secure read of %u bytes: %u transaction lists, %u SPI transactions",
+                     (unsigned int)size,
+                     (unsigned int)(listCountTotal - listStart),
+                     (unsigned int)(transactionCountTotal - transactionStart));
+    (void)listStart;
+    (void)transactionStart;
+
+    return QLIB_STATUS__OK;
+}
+
+#endif // QLIB_SPI_LIST_ENABLED
@@ -0,0 +1,44 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_sample_spi_list.h
+* @brief      This file contains QLIB SPI transaction list sample definitions
+*
+* ### project qlib_samples
+*
+************************************************************************************************************/
+
+#ifndef _QLIB_SAMPLE_SPI_LIST__H_
+#define _QLIB_SAMPLE_SPI_LIST__H_
+
+#ifdef QLIB_SPI_LIST_ENABLED
+
+/************************************************************************************************************
+ * @brief       This routine returns the statistics of the SPI transaction lists
+ *
+ * @param[out]  listCount          Number of lists submitted by QLIB
+ * @param[out]  transactionCount   Number of SPI transactions executed from the lists, including repeats
+************************************************************************************************************/
+void QLIB_SAMPLE_SpiListGetStats(U32* listCount, U32* transactionCount);
+
+/************************************************************************************************************
+ * @brief       This routine performs secure read of @p size bytes from the beginning of the section and prints
+ *              the number of secure commands submitted as transaction lists and the number of SPI
+ *              transactions they were executed with.
+ *              This function assumes the QLIB library and flash device are already initialized and a session
+ *              to the section is open.
+ *
+ * @param[out]  qlibContext     [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   sectionID       [Section index](md_definitions.html#DEF_SECTION)
+ * @param[in]   size            [Size](md_definitions.html#DEF_SIZE) to read, up to 4KB
+ *
+ * @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SAMPLE_SpiListMeasureRead(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U32 size);
+
+#endif // QLIB_SPI_LIST_ENABLED
+
+#endif // _QLIB_SAMPLE_SPI_LIST__H_
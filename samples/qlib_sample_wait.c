@@ -0,0 +1,152 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_sample_wait.c
+* @brief      This file contains QLIB platform wait while busy sample implementation
+*
+* @example    qlib_sample_wait.c
+*
+* @page       wait platform wait while busy sample code
+* This sample code shows an implementation of the platform wait while busy function, which performs
+* application work with exponential back-off between status polls, and measures the work performed per erased
+* sector. Without application work it delays until the next poll.
+* The delay and the time measurement use the platform time functions (QLIB_PLAT_TIME_ENABLED).
+*
+* @include    samples/qlib_sample_wait.c
+*
+************************************************************************************************************/
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                                  INCLUDES
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+#include "qlib.h"
+#include "qlib_sample_wait.h"
+
+#if defined QLIB_PLAT_WAIT_ENABLED && defined QLIB_PLAT_TIME_ENABLED
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                                DEFINITIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+#define QLIB_SAMPLE_WAIT_MIN_US       10   // first wait, short commands are completed within few polls
+#define QLIB_SAMPLE_WAIT_MAX_US       1000 // longest wait, limits the latency added to a long erase
+#define QLIB_SAMPLE_WAIT_MAX_BACK_OFF 7
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                              LOCAL VARIABLES
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+static QLIB_SAMPLE_WAIT_WORK_T waitWork;
+static U32                     waitUsTotal;
+static U32                     waitCountTotal;
+static U32                     workCountTotal;
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                       PLATFORM FUNCTIONS IMPLEMENTATION
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+
+QLIB_STATUS_T PLAT_SPI_WaitWhileBusy(const void* userData, U32 pollCount)
+{
+    U32 waitUs = QLIB_SAMPLE_WAIT_MIN_US << MIN(pollCount, QLIB_SAMPLE_WAIT_MAX_BACK_OFF);
+    U32 start  = PLAT_GetTimeUs();
+
+    waitUs = MIN(waitUs, QLIB_SAMPLE_WAIT_MAX_US);
+
+    if (NULL == waitWork)
+    {
+        /*---------------------------------------------------------------------------------------------------
+         No application work, delay until the next poll
+        ---------------------------------------------------------------------------------------------------*/
+        PLAT_DelayUs(userData, waitUs);
+    }
+    else
+    {
+        /*---------------------------------------------------------------------------------------------------
+         Perform application work instead of polling, until the next poll
+        ---------------------------------------------------------------------------------------------------*/
+        do
+        {
+            waitWork();
+            workCountTotal++;
+        } while (PLAT_GetTimeUs() - start < waitUs);
+    }
+
+    waitUsTotal += PLAT_GetTimeUs() - start;
+    waitCountTotal++;
+
+    return QLIB_STATUS__OK;
+}
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                             INTERFACE FUNCTIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+
+void QLIB_SAMPLE_WaitGetStats(U32* waitUs, U32* waitCount, U32* workCount)
+{
+    *waitUs    = waitUsTotal;
+    *waitCount = waitCountTotal;
+    *workCount = workCountTotal;
+}
+
+QLIB_STATUS_T QLIB_SAMPLE_WaitMeasureErase(QLIB_CONTEXT_T*         qlibContext,
+                                           U32                     sectionID,
+                                           U32                     offset,
+                                           U32                     sectorCount,
+                                           BOOL                    secure,
+                                           QLIB_SAMPLE_WAIT_WORK_T work,
+                                           U32*                    eraseUsPerSector,
+                                           U32*                    workPerSector)
+{
+    QLIB_STATUS_T ret     = QLIB_STATUS__OK;
+    U32           totalUs = 0;
+    U32           start   = 0;
+
+    QLIB_ASSERT_RET(NULL != work, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != eraseUsPerSector, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != workPerSector, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 != sectorCount, QLIB_STATUS__INVALID_PARAMETER);
+
+    /*-------------------------------------------------------------------------------------------------------
+     Reset the statistics, only the waits of the measured erase are counted
+    -------------------------------------------------------------------------------------------------------*/
+    waitUsTotal    = 0;
+    waitCountTotal = 0;
+    workCountTotal = 0;
+
+    /*-------------------------------------------------------------------------------------------------------
+     The application work is performed only while the flash is busy erasing
+    -------------------------------------------------------------------------------------------------------*/
+    waitWork = work;
+    start    = PLAT_GetTimeUs();
+    ret      = QLIB_Erase(qlibContext, sectionID, offset, sectorCount * FLASH_SECTOR_SIZE, secure);
+    totalUs  = PLAT_GetTimeUs() - start;
+    waitWork = NULL;
+    QLIB_STATUS_RET_CHECK(ret);
+
+    *eraseUsPerSector = totalUs / sectorCount;
+    *workPerSector    = workCountTotal / sectorCount;
+
+    QLIB_DEBUG_PRINT(QLIB_VERBOSE_INFO,
+                     "Erase of %u sectors: %u us per sector, %u polls, %u us in the platform wait (%u%%), %u work calls per sector",
+                     (unsigned int)sectorCount,
+                     (unsigned int)*eraseUsPerSector,
+                     (unsigned int)waitCountTotal,
+                     (unsigned int)waitUsTotal,
+                     (unsigned int)((0 != totalUs) ? ((U64)waitUsTotal * 100) / totalUs : 0),
+                     (unsigned int)*workPerSector);
+
+    return QLIB_STATUS__OK;
+}
+
+#endif // QLIB_PLAT_WAIT_ENABLED && QLIB_PLAT_TIME_ENABLED
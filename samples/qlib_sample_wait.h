@@ -0,0 +1,64 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_sample_wait.h
+* @brief      This file contains QLIB platform wait while busy sample definitions
+*
+* ### project qlib_samples
+*
+************************************************************************************************************/
+
+#ifndef _QLIB_SAMPLE_WAIT__H_
+#define _QLIB_SAMPLE_WAIT__H_
+
+#if defined QLIB_PLAT_WAIT_ENABLED && defined QLIB_PLAT_TIME_ENABLED
+
+/************************************************************************************************************
+ * Application work performed by the platform wait while the flash is busy. A call should take much less than
+ * the wait between two status polls.
+************************************************************************************************************/
+typedef void (*QLIB_SAMPLE_WAIT_WORK_T)(void);
+
+/************************************************************************************************************
+ * @brief       This routine returns the statistics of the platform wait while busy
+ *
+ * @param[out]  waitUs      Total time spent in the platform wait function, in microseconds
+ * @param[out]  waitCount   Number of waits, each wait is followed by a status poll
+ * @param[out]  workCount   Number of application work calls performed in the waits
+************************************************************************************************************/
+void QLIB_SAMPLE_WaitGetStats(U32* waitUs, U32* waitCount, U32* workCount);
+
+/************************************************************************************************************
+ * @brief       This routine measures the application work performed by the platform wait while erasing.
+ *              It erases @p sectorCount sectors from @p offset while the platform wait calls @p work between
+ *              the status polls, and prints the erase time, the number of status polls, the time spent in the
+ *              platform wait and the number of work calls per erased sector.
+ *              This function assumes the QLIB library and flash device are already initialized and the section
+ *              is accessible for erase.
+ *
+ * @param[out]  qlibContext         [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   sectionID           [Section index](md_definitions.html#DEF_SECTION)
+ * @param[in]   offset              [Section offset](md_definitions.html#DEF_OFFSET), aligned to FLASH_SECTOR_SIZE
+ * @param[in]   sectorCount         Number of sectors to erase
+ * @param[in]   secure              if TRUE, secure erase is performed
+ * @param[in]   work                Application work called while the flash is busy
+ * @param[out]  eraseUsPerSector    Erase time per erased sector, in microseconds
+ * @param[out]  workPerSector       Number of @p work calls performed per erased sector
+ *
+ * @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SAMPLE_WaitMeasureErase(QLIB_CONTEXT_T*         qlibContext,
+                                           U32                     sectionID,
+                                           U32                     offset,
+                                           U32                     sectorCount,
+                                           BOOL                    secure,
+                                           QLIB_SAMPLE_WAIT_WORK_T work,
+                                           U32*                    eraseUsPerSector,
+                                           U32*                    workPerSector);
+
+#endif // QLIB_PLAT_WAIT_ENABLED && QLIB_PLAT_TIME_ENABLED
+
+#endif // _QLIB_SAMPLE_WAIT__H_
@@ -0,0 +1,108 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_sample_warm_start.c
+* @brief      This file contains QLIB warm start sample implementation
+*
+* @example    qlib_sample_warm_start.c
+*
+* @page       warm_start warm start sample code
+* This sample code shows that a stale or corrupted synchronization object passed to QLIB_InitDeviceFromState
+* is rejected, and the device is initialized by the auto-sense fallback instead.
+*
+* @include    samples/qlib_sample_warm_start.c
+*
+************************************************************************************************************/
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                                  INCLUDES
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+#include "qlib.h"
+#include "qlib_sample_warm_start.h"
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                       LOCAL FUNCTIONS DECLARATION
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+static QLIB_STATUS_T QLIB_SAMPLE_WarmStartCheck_L(QLIB_CONTEXT_T*        qlibContext,
+                                                  const QLIB_SYNC_OBJ_T* syncObject,
+                                                  const QLIB_SYNC_OBJ_T* importObject);
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                             INTERFACE FUNCTIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+
+QLIB_STATUS_T QLIB_SAMPLE_WarmStartFallback(QLIB_CONTEXT_T* qlibContext)
+{
+    QLIB_SYNC_OBJ_T syncObject;
+    QLIB_SYNC_OBJ_T importObject;
+
+    QLIB_STATUS_RET_CHECK(QLIB_ExportState(qlibContext, &syncObject));
+    QLIB_ASSERT_RET(TRUE == syncObject.deviceState.valid, QLIB_STATUS__TEST_FAIL);
+
+    /*-------------------------------------------------------------------------------------------------------
+     State of another flash, the Winbond ID does not match the connected flash
+    -------------------------------------------------------------------------------------------------------*/
+    importObject = syncObject;
+    importObject.wid[0] ^= 0xFF;
+    QLIB_STATUS_RET_CHECK(QLIB_SAMPLE_WarmStartCheck_L(qlibContext, &syncObject, &importObject));
+
+    /*-------------------------------------------------------------------------------------------------------
+     Corrupted state, the address size is out of range. The Winbond ID is changed too, to detect the fallback
+    -------------------------------------------------------------------------------------------------------*/
+    importObject = syncObject;
+    importObject.wid[0] ^= 0xFF;
+    importObject.deviceState.addrSize = MAX_U32;
+    QLIB_STATUS_RET_CHECK(QLIB_SAMPLE_WarmStartCheck_L(qlibContext, &syncObject, &importObject));
+
+    /*-------------------------------------------------------------------------------------------------------
+     Valid state, the device is initialized from it
+    -------------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(QLIB_InitDeviceFromState(qlibContext, &syncObject));
+
+    return QLIB_STATUS__OK;
+}
+
+/*-----------------------------------------------------------------------------------------------------------
+-------------------------------------------------------------------------------------------------------------
+                                               LOCAL FUNCTIONS
+-------------------------------------------------------------------------------------------------------------
+-----------------------------------------------------------------------------------------------------------*/
+
+/************************************************************************************************************
+ * @brief       This routine initializes the device from a rejected state and checks the fallback was taken.
+ *              The Winbond ID of @p importObject differs from the connected flash, so it is kept in the
+ *              context only if the state was not rejected.
+ *
+ * @param[out]  qlibContext    [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   syncObject     State exported from the connected flash
+ * @param[in]   importObject   State to import
+ *
+ * @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_SAMPLE_WarmStartCheck_L(QLIB_CONTEXT_T*        qlibContext,
+                                                  const QLIB_SYNC_OBJ_T* syncObject,
+                                                  const QLIB_SYNC_OBJ_T* importObject)
+{
+    QLIB_SYNC_OBJ_T exportObject;
+
+    QLIB_STATUS_RET_CHECK(QLIB_InitDeviceFromState(qlibContext, importObject));
+    QLIB_STATUS_RET_CHECK(QLIB_ExportState(qlibContext, &exportObject));
+
+    if (0 != memcmp(exportObject.wid, syncObject->wid, sizeof(QLIB_WID_T)) ||
+        exportObject.deviceState.addrSize != syncObject->deviceState.addrSize)
+    {
+        QLIB_DEBUG_PRINT(QLIB_VERBOSE_ERROR, "Rejected state was used, fallback initialization was not performed\r\n");
+        return QLIB_STATUS__TEST_FAIL;
+    }
+
+    return QLIB_STATUS__OK;
+}
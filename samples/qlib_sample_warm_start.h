@@ -0,0 +1,34 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_sample_warm_start.h
+* @brief      This file contains QLIB warm start sample definitions
+*
+* ### project qlib_samples
+*
+************************************************************************************************************/
+
+#ifndef _QLIB_SAMPLE_WARM_START__H_
+#define _QLIB_SAMPLE_WARM_START__H_
+
+/************************************************************************************************************
+ * @brief       This routine checks the fallback of @ref QLIB_InitDeviceFromState.
+ *              The state of the connected flash is exported, and imported with a mismatched Winbond ID and
+ *              with an out of range address size. In both cases the device must be initialized by the
+ *              auto-sense fallback, which reads the Winbond ID of the connected flash again.
+ *              Finally the exported state is imported as is.
+ *              This function assumes the QLIB library and flash device are already initialized.
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred\n
+ * QLIB_STATUS__TEST_FAIL               - the mismatched state was used instead of the fallback\n
+ * QLIB_STATUS__(ERROR)                 - Other error
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SAMPLE_WarmStartFallback(QLIB_CONTEXT_T* qlibContext);
+
+#endif // _QLIB_SAMPLE_WARM_START__H_
@@ -27,12 +27,36 @@
 /*---------------------------------------------------------------------------------------------------------*/
 #define QLIB_DEVICE_INITIALIZED(qlibContext) ((qlibContext)->busInterface.busMode != QLIB_BUS_MODE_INVALID)
 
+/************************************************************************************************************
+ * Minimal read size, in bytes, routed by @ref QLIB_ReadAuto to the plain read path.
+ * Smaller reads do not amortize the section policy check, and are read by secure reads.
+ * User may choose to define a different value.
+************************************************************************************************************/
+#ifndef QLIB_READ_AUTO_PLAIN_THRESHOLD
+#define QLIB_READ_AUTO_PLAIN_THRESHOLD 4096
+#endif
+
+#ifdef QLIB_BUS_TUNE_ENABLED
+/************************************************************************************************************
+ * Number of pattern reads of each bus format auto-tuning candidate
+************************************************************************************************************/
+#define QLIB_BUS_TUNE_READS 4
+#endif
+
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                        LOCAL FUNCTION PROTOTYPES                                        */
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 QLIB_STATUS_T QLIB_IsFlashSecure_L(QLIB_CONTEXT_T* qlibContext, BOOL* secure);
+#ifndef QLIB_SEC_ONLY
+static BOOL QLIB_ReadAutoIsPlain_L(QLIB_CONTEXT_T* qlibContext, const U8* buf, U32 sectionID, U32 offset, U32 size, BOOL verify);
+#endif
+#ifdef QLIB_BUS_TUNE_ENABLED
+static QLIB_STATUS_T QLIB_BusTune_L(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_TUNE_T* busTune);
+static QLIB_STATUS_T QLIB_BusTuneSet_L(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_FORMAT_T busFormat, U8 dummyCycles);
+static QLIB_STATUS_T QLIB_BusTuneRead_L(QLIB_CONTEXT_T* qlibContext, const U8* reference, U32* readTimeUs);
+#endif
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                           INTERFACE FUNCTIONS                                           */
@@ -138,7 +162,11 @@ QLIB_STATUS_T QLIB_InitDevice(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_FORMAT_T bus
             QLIB_STATUS_RET_CHECK(QLIB_SEC__get_SSR(qlibContext, NULL, SSR_MASK__ALL_ERRORS));
         }
     }
-    if (QLIB_BUS_FORMAT_GET_MODE(busFormat) != QLIB_BUS_MODE_AUTOSENSE)
+    if (QLIB_BUS_FORMAT_GET_MODE(busFormat) != QLIB_BUS_MODE_AUTOSENSE
+#ifdef QLIB_BUS_TUNE_ENABLED
+        && QLIB_BUS_FORMAT_GET_MODE(busFormat) != QLIB_BUS_MODE_AUTOTUNE
+#endif
+    )
     {
         QLIB_STATUS_RET_CHECK(QLIB_SetInterface(qlibContext, busFormat));
     }
@@ -157,11 +185,99 @@ QLIB_STATUS_T QLIB_InitDevice(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_FORMAT_T bus
     QLIB_STATUS_RET_CHECK(QLIB_STD_EraseResume(qlibContext, TRUE));
 #endif // QLIB_SEC_ONLY
 
+#ifdef QLIB_STD_SFDP_ENABLED
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Discover the device geometry and timing                                                             */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(QLIB_STD_ReadSfdp(qlibContext, &qlibContext->sfdp));
+#endif
+
     /*-----------------------------------------------------------------------------------------------------*/
     /* synchronize the lib state with the flash secure module state                                        */
     /*-----------------------------------------------------------------------------------------------------*/
     QLIB_STATUS_RET_CHECK(QLIB_SEC_SyncState(qlibContext));
 
+#ifdef QLIB_BUS_TUNE_ENABLED
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Select the fastest bus format which reads the pattern correctly                                     */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (QLIB_BUS_FORMAT_GET_MODE(busFormat) == QLIB_BUS_MODE_AUTOTUNE)
+    {
+        QLIB_STATUS_RET_CHECK(QLIB_BusTune_L(qlibContext, &qlibContext->busTune));
+    }
+#endif
+
+    return QLIB_STATUS__OK;
+}
+
+QLIB_STATUS_T QLIB_InitDeviceFromState(QLIB_CONTEXT_T* qlibContext, const QLIB_SYNC_OBJ_T* syncObject)
+{
+    QLIB_STATUS_T status = QLIB_STATUS__COMMAND_IGNORED;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != syncObject, QLIB_STATUS__INVALID_PARAMETER);
+
+    if (TRUE == syncObject->deviceState.valid)
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Restore the bus interface and the device state, no auto-sense and no state synchronization      */
+        /*-------------------------------------------------------------------------------------------------*/
+        QLIB_STATUS_RET_CHECK(QLIB_ImportState(qlibContext, syncObject));
+        status = QLIB_STATUS__OK;
+
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+        /*-------------------------------------------------------------------------------------------------*/
+        /* The flash may still be in continuous read mode, reset it before the first instruction           */
+        /*-------------------------------------------------------------------------------------------------*/
+        status = QLIB_STD_ContinuousReadReset(qlibContext);
+#endif
+
+#ifndef QLIB_SEC_ONLY
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Resume power-down and any suspended erase / write command before accessing the secure module    */
+        /*-------------------------------------------------------------------------------------------------*/
+        if (QLIB_STATUS__OK == status)
+        {
+            status = QLIB_STD_Power(qlibContext, QLIB_POWER_UP);
+        }
+        if (QLIB_STATUS__OK == status)
+        {
+            status = QLIB_STD_EraseResume(qlibContext, TRUE);
+        }
+#endif // QLIB_SEC_ONLY
+
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Synchronize after reset and validate the state belongs to the connected flash                   */
+        /*-------------------------------------------------------------------------------------------------*/
+        if (QLIB_STATUS__OK == status)
+        {
+            status = QLIB_SEC_ImportDeviceState(qlibContext, &syncObject->deviceState);
+        }
+
+#ifdef QLIB_BUS_TUNE_ENABLED
+        /*-------------------------------------------------------------------------------------------------*/
+        /* A flash reset restores the default QPI read dummy cycles, set the exported ones again           */
+        /*-------------------------------------------------------------------------------------------------*/
+        if (QLIB_STATUS__OK == status && QLIB_BUS_MODE_4_4_4 == qlibContext->busInterface.busMode &&
+            0 != qlibContext->qpiReadDummyCycles)
+        {
+            status = QLIB_STD_SetReadParameters(qlibContext, qlibContext->qpiReadDummyCycles);
+        }
+#endif
+    }
+
+    if (QLIB_STATUS__OK != status)
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* State is missing or stale, perform full initialization                                          */
+        /*-------------------------------------------------------------------------------------------------*/
+        qlibContext->busInterface.busMode = QLIB_BUS_MODE_INVALID;
+        QLIB_STATUS_RET_CHECK(QLIB_InitDevice(qlibContext, QLIB_BUS_FORMAT_AUTOSENSE));
+    }
+
     return QLIB_STATUS__OK;
 }
 
@@ -205,6 +321,144 @@ QLIB_STATUS_T QLIB_Read(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID, U32
     }
 }
 
+QLIB_STATUS_T QLIB_ReadV(QLIB_CONTEXT_T* qlibContext, QLIB_READ_RANGE_T* ranges, U32 count, U32 sectionID, BOOL secure, BOOL auth)
+{
+    U32           maxOffset = 0;
+    U32           i         = 0;
+    QLIB_STATUS_T ret       = QLIB_STATUS__OK;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != ranges, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 < count, QLIB_STATUS__PARAMETER_OUT_OF_RANGE);
+
+    if (TRUE == secure)
+    {
+        QLIB_ASSERT_RET(QLIB_NUM_OF_SECTIONS > sectionID, QLIB_STATUS__INVALID_PARAMETER);
+        maxOffset = QLIB_REG_SMRn__LEN_IN_TAG_TO_BYTES(qlibContext->sectionsState[sectionID].sizeTag);
+    }
+    else
+    {
+#ifndef QLIB_SEC_ONLY
+        QLIB_ASSERT_RET(sectionID < _QLIB_MAX_LEGACY_SECTION_ID(qlibContext), QLIB_STATUS__PARAMETER_OUT_OF_RANGE);
+        maxOffset = _QLIB_MAX_LEGACY_OFFSET(qlibContext);
+        QLIB_EXECUTE_FOR_SECURE_FLASH_ONLY(qlibContext,
+                                           maxOffset = MIN(maxOffset,
+                                                           QLIB_REG_SMRn__LEN_IN_TAG_TO_BYTES(
+                                                               qlibContext->sectionsState[QLIB_FALLBACK_SECTION(qlibContext, sectionID)]
+                                                                   .sizeTag)));
+#else
+        return QLIB_STATUS__NOT_SUPPORTED;
+#endif // QLIB_SEC_ONLY
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Check each range, invalid ranges are skipped                                                        */
+    /*-----------------------------------------------------------------------------------------------------*/
+    for (i = 0; i < count; i++)
+    {
+        if ((NULL == ranges[i].buf) || ((ranges[i].offset + ranges[i].size) < ranges[i].size))
+        {
+            ranges[i].status = QLIB_STATUS__INVALID_PARAMETER;
+        }
+        else if ((0 == ranges[i].size) || ((ranges[i].offset + ranges[i].size) > maxOffset))
+        {
+            ranges[i].status = QLIB_STATUS__PARAMETER_OUT_OF_RANGE;
+        }
+        else
+        {
+            ranges[i].status = QLIB_STATUS__OK;
+        }
+    }
+
+    if (TRUE == secure)
+    {
+        ret = QLIB_SEC_ReadV(qlibContext, ranges, count, sectionID, auth);
+    }
+#ifndef QLIB_SEC_ONLY
+    else
+    {
+        U32 q2Section = QLIB_VALUE_BY_FLASH_TYPE(qlibContext, QLIB_FALLBACK_SECTION(qlibContext, sectionID), sectionID);
+        QLIB_EXECUTE_FOR_SECURE_FLASH_ONLY(
+            qlibContext,
+            if (qlibContext->sectionsState[q2Section].plainEnabled == 0) {
+                QLIB_STATUS_RET_CHECK(QLIB_PlainAccessEnable(qlibContext, q2Section));
+            });
+
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Plain reads have no per page setup, so each range is read directly to its buffer                */
+        /*-------------------------------------------------------------------------------------------------*/
+        for (i = 0; i < count; i++)
+        {
+            if (QLIB_STATUS__OK == ranges[i].status)
+            {
+                ranges[i].status =
+                    QLIB_STD_Read(qlibContext,
+                                  ranges[i].buf,
+                                  _QLIB_MAKE_LOGICAL_ADDRESS(sectionID, ranges[i].offset, qlibContext->addrSize),
+                                  ranges[i].size);
+            }
+        }
+    }
+#endif // QLIB_SEC_ONLY
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Return the status of the first failed range                                                         */
+    /*-----------------------------------------------------------------------------------------------------*/
+    for (i = 0; (i < count) && (QLIB_STATUS__OK == ret); i++)
+    {
+        ret = ranges[i].status;
+    }
+
+    return ret;
+}
+
+QLIB_STATUS_T QLIB_ReadAuto(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID, U32 offset, U32 size, BOOL verify)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != buf, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(QLIB_NUM_OF_SECTIONS > sectionID, QLIB_STATUS__INVALID_PARAMETER);
+
+#ifndef QLIB_SEC_ONLY
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Large reads of sections permitted for plain read use the plain read path                            */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (TRUE == QLIB_ReadAutoIsPlain_L(qlibContext, buf, sectionID, offset, size, verify))
+    {
+        QLIB_STATUS_RET_CHECK(QLIB_Read(qlibContext, buf, sectionID, offset, size, FALSE, FALSE));
+
+        if (TRUE == verify)
+        {
+            _256BIT       hash;
+            QLIB_STATUS_T ret;
+
+            /*---------------------------------------------------------------------------------------------*/
+            /* The whole section is authenticated by the section digest calculated by the device           */
+            /*---------------------------------------------------------------------------------------------*/
+            PLAT_HASH(hash, (const U32*)(UPTR)buf, size);
+            ret = QLIB_SEC_VerifySectionDigest(qlibContext, sectionID, hash);
+            if (QLIB_STATUS__OK != ret)
+            {
+                memset(buf, 0, size);
+                return ret;
+            }
+        }
+
+        return QLIB_STATUS__OK;
+    }
+#endif // QLIB_SEC_ONLY
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Other reads use the secure read path, authenticated if verification is requested                   */
+    /*-----------------------------------------------------------------------------------------------------*/
+    return QLIB_Read(qlibContext, buf, sectionID, offset, size, TRUE, verify);
+}
+
 QLIB_STATUS_T QLIB_Write(QLIB_CONTEXT_T* qlibContext, const U8* buf, U32 sectionID, U32 offset, U32 size, BOOL secure)
 {
     /*-----------------------------------------------------------------------------------------------------*/
@@ -237,6 +491,7 @@ QLIB_STATUS_T QLIB_Write(QLIB_CONTEXT_T* qlibContext, const U8* buf, U32 section
             if (qlibContext->sectionsState[q2Section].plainEnabled == 0) {
                 QLIB_STATUS_RET_CHECK(QLIB_PlainAccessEnable(qlibContext, q2Section));
             });
+        QLIB_SEC_READ_CACHE_INVALIDATE(qlibContext);
         return QLIB_STD_Write(qlibContext, buf, _QLIB_MAKE_LOGICAL_ADDRESS(sectionID, offset, qlibContext->addrSize), size);
 #else
         return QLIB_STATUS__NOT_SUPPORTED;
@@ -244,6 +499,62 @@ QLIB_STATUS_T QLIB_Write(QLIB_CONTEXT_T* qlibContext, const U8* buf, U32 section
     }
 }
 
+QLIB_STATUS_T QLIB_WriteV(QLIB_CONTEXT_T*              qlibContext,
+                          const QLIB_WRITE_FRAGMENT_T* fragments,
+                          U32                          count,
+                          U32                          sectionID,
+                          U32                          offset,
+                          BOOL                         secure)
+{
+    U32 size = 0;
+    U32 i    = 0;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != fragments, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 < count, QLIB_STATUS__PARAMETER_OUT_OF_RANGE);
+
+    for (i = 0; i < count; i++)
+    {
+        QLIB_ASSERT_RET((NULL != fragments[i].buf) || (0 == fragments[i].size), QLIB_STATUS__INVALID_PARAMETER);
+        QLIB_ASSERT_RET((size + fragments[i].size) >= size, QLIB_STATUS__INVALID_PARAMETER);
+        size = size + fragments[i].size;
+    }
+
+    QLIB_ASSERT_RET(0 < size, QLIB_STATUS__PARAMETER_OUT_OF_RANGE);
+    QLIB_ASSERT_RET((offset + size) >= size, QLIB_STATUS__INVALID_PARAMETER);
+
+    if (TRUE == secure)
+    {
+        QLIB_ASSERT_RET(QLIB_NUM_OF_SECTIONS > sectionID, QLIB_STATUS__INVALID_PARAMETER);
+        QLIB_ASSERT_RET((offset + size) <= QLIB_REG_SMRn__LEN_IN_TAG_TO_BYTES(qlibContext->sectionsState[sectionID].sizeTag),
+                        QLIB_STATUS__PARAMETER_OUT_OF_RANGE);
+        return QLIB_SEC_WriteV(qlibContext, fragments, count, sectionID, offset, size);
+    }
+    else
+    {
+#ifndef QLIB_SEC_ONLY
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Plain writes take the fragments directly, one write per fragment                                */
+        /*-------------------------------------------------------------------------------------------------*/
+        for (i = 0; i < count; i++)
+        {
+            if (0 != fragments[i].size)
+            {
+                QLIB_STATUS_RET_CHECK(QLIB_Write(qlibContext, fragments[i].buf, sectionID, offset, fragments[i].size, FALSE));
+                offset = offset + fragments[i].size;
+            }
+        }
+
+        return QLIB_STATUS__OK;
+#else
+        return QLIB_STATUS__NOT_SUPPORTED;
+#endif // QLIB_SEC_ONLY
+    }
+}
+
 QLIB_STATUS_T QLIB_Erase(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U32 offset, U32 size, BOOL secure)
 {
     /*-----------------------------------------------------------------------------------------------------*/
@@ -277,6 +588,7 @@ QLIB_STATUS_T QLIB_Erase(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U32 offset,
             if (qlibContext->sectionsState[q2Section].plainEnabled == 0) {
                 QLIB_STATUS_RET_CHECK(QLIB_PlainAccessEnable(qlibContext, q2Section));
             });
+        QLIB_SEC_READ_CACHE_INVALIDATE(qlibContext);
         return QLIB_STD_Erase(qlibContext, _QLIB_MAKE_LOGICAL_ADDRESS(sectionID, offset, qlibContext->addrSize), size);
 #else
         return QLIB_STATUS__NOT_SUPPORTED;
@@ -310,6 +622,104 @@ QLIB_STATUS_T QLIB_EraseSection(QLIB_CONTEXT_T* qlibContext, U32 sectionID, BOOL
     return QLIB_SEC_EraseSection(qlibContext, sectionID, secure);
 }
 
+QLIB_STATUS_T QLIB_EraseV(QLIB_CONTEXT_T* qlibContext, QLIB_ERASE_RANGE_T* ranges, U32 count, U32 sectionID, BOOL secure)
+{
+    QLIB_ERASE_RANGE_T range;
+    U32                maxOffset   = 0;
+    U32                sectionSize = 0;
+    U32                start;
+    U32                end;
+    U32                i;
+    U32                j;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != ranges, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 < count, QLIB_STATUS__PARAMETER_OUT_OF_RANGE);
+
+    if (TRUE == secure)
+    {
+        QLIB_ASSERT_RET(QLIB_NUM_OF_SECTIONS > sectionID, QLIB_STATUS__INVALID_PARAMETER);
+        maxOffset   = QLIB_REG_SMRn__LEN_IN_TAG_TO_BYTES(qlibContext->sectionsState[sectionID].sizeTag);
+        sectionSize = maxOffset;
+    }
+    else
+    {
+#ifndef QLIB_SEC_ONLY
+        QLIB_ASSERT_RET(sectionID < _QLIB_MAX_LEGACY_SECTION_ID(qlibContext), QLIB_STATUS__PARAMETER_OUT_OF_RANGE);
+        maxOffset = _QLIB_MAX_LEGACY_OFFSET(qlibContext);
+        QLIB_EXECUTE_FOR_SECURE_FLASH_ONLY(qlibContext,
+                                           maxOffset = MIN(maxOffset,
+                                                           QLIB_REG_SMRn__LEN_IN_TAG_TO_BYTES(
+                                                               qlibContext->sectionsState[QLIB_FALLBACK_SECTION(qlibContext, sectionID)]
+                                                                   .sizeTag)));
+        // plain section erase erases the section itself, so only a section which is not a fallback is covered
+        QLIB_EXECUTE_FOR_SECURE_FLASH_ONLY(
+            qlibContext,
+            if (QLIB_FALLBACK_SECTION(qlibContext, sectionID) == sectionID) {
+                sectionSize = QLIB_REG_SMRn__LEN_IN_TAG_TO_BYTES(qlibContext->sectionsState[sectionID].sizeTag);
+            });
+#else
+        return QLIB_STATUS__NOT_SUPPORTED;
+#endif // QLIB_SEC_ONLY
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        QLIB_ASSERT_RET((ranges[i].offset + ranges[i].size) >= ranges[i].size, QLIB_STATUS__INVALID_PARAMETER);
+        QLIB_ASSERT_RET(0 < ranges[i].size, QLIB_STATUS__PARAMETER_OUT_OF_RANGE);
+        QLIB_ASSERT_RET((ranges[i].offset + ranges[i].size) <= maxOffset, QLIB_STATUS__PARAMETER_OUT_OF_RANGE);
+        QLIB_ASSERT_RET(0 == (ranges[i].offset % FLASH_SECTOR_SIZE), QLIB_STATUS__INVALID_DATA_ALIGNMENT);
+        QLIB_ASSERT_RET(0 == (ranges[i].size % FLASH_SECTOR_SIZE), QLIB_STATUS__INVALID_DATA_ALIGNMENT);
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Sort the ranges by offset (insertion sort, plans are short)                                         */
+    /*-----------------------------------------------------------------------------------------------------*/
+    for (i = 1; i < count; i++)
+    {
+        range = ranges[i];
+        for (j = i; (0 < j) && (ranges[j - 1].offset > range.offset); j--)
+        {
+            ranges[j] = ranges[j - 1];
+        }
+        ranges[j] = range;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* A plan which covers the whole section is erased by a single section erase                           */
+    /*-----------------------------------------------------------------------------------------------------*/
+    start = ranges[0].offset;
+    end   = ranges[0].offset + ranges[0].size;
+    for (i = 1; (i < count) && (ranges[i].offset <= end); i++)
+    {
+        end = MAX(end, ranges[i].offset + ranges[i].size);
+    }
+    if ((i == count) && (0 == start) && (0 != sectionSize) && (sectionSize == end))
+    {
+        return QLIB_EraseSection(qlibContext, sectionID, secure);
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Erase each run of merged ranges                                                                     */
+    /*-----------------------------------------------------------------------------------------------------*/
+    i = 0;
+    while (i < count)
+    {
+        start = ranges[i].offset;
+        end   = ranges[i].offset + ranges[i].size;
+        for (i++; (i < count) && (ranges[i].offset <= end); i++)
+        {
+            end = MAX(end, ranges[i].offset + ranges[i].size);
+        }
+        QLIB_STATUS_RET_CHECK(QLIB_Erase(qlibContext, sectionID, start, end - start, secure));
+    }
+
+    return QLIB_STATUS__OK;
+}
+
 #ifndef QLIB_SEC_ONLY
 QLIB_STATUS_T QLIB_Suspend(QLIB_CONTEXT_T* qlibContext)
 {
@@ -353,6 +763,7 @@ QLIB_STATUS_T QLIB_Power(QLIB_CONTEXT_T* qlibContext, QLIB_POWER_T power)
     /* Error checking                                                                                      */
     /*-----------------------------------------------------------------------------------------------------*/
     QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_SEC_READ_CACHE_INVALIDATE(qlibContext);
     QLIB_STATUS_RET_CHECK(QLIB_STD_Power(qlibContext, power));
 
     /*-----------------------------------------------------------------------------------------------------*/
@@ -418,6 +829,19 @@ QLIB_STATUS_T QLIB_PerformMaintenance(QLIB_CONTEXT_T* qlibContext)
     return QLIB_SEC_PerformMCMaint(qlibContext);
 }
 
+#ifdef QLIB_MAINT_SCHED_ENABLED
+QLIB_STATUS_T QLIB_PerformMaintenanceIdle(QLIB_CONTEXT_T* qlibContext, U32 idleUs, BOOL* pending)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != pending, QLIB_STATUS__INVALID_PARAMETER);
+
+    return QLIB_SEC_PerformMCMaintIdle(qlibContext, idleUs, pending);
+}
+#endif // QLIB_MAINT_SCHED_ENABLED
+
 QLIB_STATUS_T QLIB_ConfigDevice(QLIB_CONTEXT_T*                   qlibContext,
                                 const KEY_T                       deviceMasterKey,
                                 const KEY_T                       deviceSecretKey,
@@ -657,6 +1081,17 @@ QLIB_STATUS_T QLIB_CheckIntegrity(QLIB_CONTEXT_T* qlibContext, U32 sectionID, QL
     return QLIB_SEC_CheckIntegrity(qlibContext, sectionID, integrityType);
 }
 
+QLIB_STATUS_T QLIB_CalcSectionDigest(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U64* digest)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != digest, QLIB_STATUS__INVALID_PARAMETER);
+
+    return QLIB_SEC_CalcSectionDigest(qlibContext, sectionID, digest);
+}
+
 QLIB_STATUS_T QLIB_CalcCDI(QLIB_CONTEXT_T* qlibContext, _256BIT nextCdi, _256BIT prevCdi, U32 sectionId)
 {
     /*-----------------------------------------------------------------------------------------------------*/
@@ -800,6 +1235,7 @@ QLIB_STATUS_T QLIB_ExportState(QLIB_CONTEXT_T* qlibContext, QLIB_SYNC_OBJ_T* syn
     syncObject->busInterface.busIsLocked = FALSE;
     memcpy(syncObject->wid, qlibContext->wid, sizeof(QLIB_WID_T));
     syncObject->resetStatus = qlibContext->resetStatus;
+    QLIB_STATUS_RET_CHECK(QLIB_SEC_ExportDeviceState(qlibContext, &syncObject->deviceState));
 
     return QLIB_STATUS__OK;
 }
@@ -826,6 +1262,158 @@ QLIB_STATUS_T QLIB_ImportState(QLIB_CONTEXT_T* qlibContext, const QLIB_SYNC_OBJ_
     return QLIB_STATUS__OK;
 }
 
+#ifdef QLIB_SEC_READ_CACHE_SIZE
+QLIB_STATUS_T QLIB_ReadCache_Enable(QLIB_CONTEXT_T* qlibContext, U32 sectionID, BOOL enable)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(QLIB_NUM_OF_SECTIONS > sectionID, QLIB_STATUS__INVALID_PARAMETER);
+
+    return QLIB_SEC_ReadCacheEnable(qlibContext, sectionID, enable);
+}
+
+QLIB_STATUS_T QLIB_ReadCache_GetStats(QLIB_CONTEXT_T* qlibContext, U32* hits, U32* misses)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+
+    if (NULL != hits)
+    {
+        *hits = qlibContext->readCache.hits;
+    }
+    if (NULL != misses)
+    {
+        *misses = qlibContext->readCache.misses;
+    }
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_SEC_READ_CACHE_SIZE
+
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+QLIB_STATUS_T QLIB_OpTimeModel_GetStats(QLIB_CONTEXT_T* qlibContext, QLIB_OP_TIME_STATS_T* stats, U32 maxEntries, U32* numEntries)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != numEntries, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != stats || 0 == maxEntries, QLIB_STATUS__INVALID_PARAMETER);
+
+    QLIB_TM_OpTimeGetStats(qlibContext, stats, maxEntries, numEntries);
+
+    return QLIB_STATUS__OK;
+}
+
+QLIB_STATUS_T QLIB_OpTimeModel_Reset(QLIB_CONTEXT_T* qlibContext)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+
+    QLIB_TM_OpTimeReset(qlibContext);
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_OP_TIME_MODEL_SIZE
+
+#ifdef QLIB_IRQ_OFF_STATS_SIZE
+QLIB_STATUS_T QLIB_IrqOffStats_Get(QLIB_CONTEXT_T* qlibContext, QLIB_IRQ_OFF_STATS_T* stats)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != stats, QLIB_STATUS__INVALID_PARAMETER);
+
+    memcpy(stats, &qlibContext->irqOffStats, sizeof(QLIB_IRQ_OFF_STATS_T));
+
+    return QLIB_STATUS__OK;
+}
+
+QLIB_STATUS_T QLIB_IrqOffStats_Reset(QLIB_CONTEXT_T* qlibContext)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+
+    memset(&qlibContext->irqOffStats, 0, sizeof(QLIB_IRQ_OFF_STATS_T));
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_IRQ_OFF_STATS_SIZE
+
+#ifdef QLIB_BUS_TUNE_ENABLED
+QLIB_STATUS_T QLIB_BusTune_Get(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_TUNE_T* busTune)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != busTune, QLIB_STATUS__INVALID_PARAMETER);
+
+    memcpy(busTune, &qlibContext->busTune, sizeof(QLIB_BUS_TUNE_T));
+
+    return QLIB_STATUS__OK;
+}
+
+QLIB_STATUS_T QLIB_BusTune_Apply(QLIB_CONTEXT_T* qlibContext, const QLIB_BUS_TUNE_T* busTune)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != busTune, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(QLIB_DEVICE_INITIALIZED(qlibContext), QLIB_STATUS__SYSTEM_IN_INCORRECT_STATE);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Set the persisted decision without tuning again                                                     */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(QLIB_BusTuneSet_L(qlibContext, busTune->busFormat, busTune->dummyCycles));
+    memcpy(&qlibContext->busTune, busTune, sizeof(QLIB_BUS_TUNE_T));
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_BUS_TUNE_ENABLED
+
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+QLIB_STATUS_T QLIB_ContinuousRead_Enable(QLIB_CONTEXT_T* qlibContext, BOOL enable)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* An active continuous read mode is exited by the next command                                        */
+    /*-----------------------------------------------------------------------------------------------------*/
+    qlibContext->continuousReadEnabled = (TRUE == enable) ? TRUE : FALSE;
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_STD_CONTINUOUS_READ_ENABLED
+
+#ifdef QLIB_STD_SFDP_ENABLED
+QLIB_STATUS_T QLIB_GetSfdp(QLIB_CONTEXT_T* qlibContext, QLIB_SFDP_T* sfdp)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != sfdp, QLIB_STATUS__INVALID_PARAMETER);
+
+    memcpy(sfdp, &qlibContext->sfdp, sizeof(QLIB_SFDP_T));
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_STD_SFDP_ENABLED
+
 U32 QLIB_GetVersion(void)
 {
     return QLIB_VERSION;
@@ -863,3 +1451,251 @@ QLIB_STATUS_T QLIB_IsFlashSecure_L(QLIB_CONTEXT_T* qlibContext, BOOL* secure)
     return QLIB_STATUS__OK;
 }
 
+#ifndef QLIB_SEC_ONLY
+/************************************************************************************************************
+* @brief       This routine decides if @ref QLIB_ReadAuto reads by the plain read path.
+*              The plain read path is used for reads of at least QLIB_READ_AUTO_PLAIN_THRESHOLD bytes from a
+*              section which is not remapped and whose policy permits plain read. A verified read must cover the
+*              section digest area, i.e. the whole section or the active half of a rollback protected section,
+*              into a 32 bit aligned buffer.
+*
+* @param       qlibContext   qlib context object
+* @param       buf           Output buffer
+* @param       sectionID     Section index
+* @param       offset        Section offset
+* @param       size          Size of read data
+* @param       verify        If TRUE the read data is verified
+*
+* @return      TRUE if the plain read path should be used, FALSE otherwise
+************************************************************************************************************/
+static BOOL QLIB_ReadAutoIsPlain_L(QLIB_CONTEXT_T* qlibContext, const U8* buf, U32 sectionID, U32 offset, U32 size, BOOL verify)
+{
+    U32           sectionSize = QLIB_REG_SMRn__LEN_IN_TAG_TO_BYTES(qlibContext->sectionsState[sectionID].sizeTag);
+    QLIB_POLICY_T policy;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Checks which do not need the section policy                                                         */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if ((QLIB_READ_AUTO_PLAIN_THRESHOLD > size) || ((offset + size) < size) || ((offset + size) > sectionSize) ||
+        (sectionID != (U32)QLIB_FALLBACK_SECTION(qlibContext, sectionID)) ||
+        (sectionID >= _QLIB_MAX_LEGACY_SECTION_ID(qlibContext)) || ((offset + size) > _QLIB_MAX_LEGACY_OFFSET(qlibContext)))
+    {
+        return FALSE;
+    }
+
+    if ((TRUE == verify) && ((0 != offset) || (0 != ((UPTR)buf & 0x3))))
+    {
+        return FALSE;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Check the section policy                                                                            */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (QLIB_STATUS__OK != QLIB_GetSectionConfiguration(qlibContext, sectionID, NULL, NULL, &policy, NULL, NULL, NULL))
+    {
+        return FALSE;
+    }
+
+    if ((0 == policy.plainAccessReadEnable) ||
+        ((1 == policy.authPlainAccess) && (0 == qlibContext->sectionsState[sectionID].plainEnabled)))
+    {
+        return FALSE;
+    }
+
+    if ((TRUE == verify) && (size != ((1 == policy.rollbackProt) ? (sectionSize / 2) : sectionSize)))
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+#endif // QLIB_SEC_ONLY
+
+#ifdef QLIB_BUS_TUNE_ENABLED
+/************************************************************************************************************
+* @brief       This routine selects the fastest bus format and QPI read dummy cycles which read the pattern at
+*              QLIB_BUS_TUNE_ADDRESS correctly. The reference pattern is read in single SPI. If the pattern can
+*              not be read (e.g. the address is not plain readable) or it is uniform, it can not validate the
+*              candidates, and the current bus format and QPI read dummy cycles are kept.
+*
+* @param       qlibContext   qlib context object
+* @param[out]  busTune       Tuning decision
+*
+* @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_BusTune_L(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_TUNE_T* busTune)
+{
+    static const QLIB_BUS_FORMAT_T formats[] = {
+        QLIB_BUS_FORMAT(QLIB_BUS_MODE_1_1_1, FALSE, TRUE),
+        QLIB_BUS_FORMAT(QLIB_BUS_MODE_1_1_1, TRUE, TRUE),
+#ifdef QLIB_SUPPORT_DUAL_SPI
+        QLIB_BUS_FORMAT(QLIB_BUS_MODE_1_1_2, FALSE, TRUE),
+        QLIB_BUS_FORMAT(QLIB_BUS_MODE_1_2_2, FALSE, TRUE),
+        QLIB_BUS_FORMAT(QLIB_BUS_MODE_1_2_2, TRUE, TRUE),
+#endif
+        QLIB_BUS_FORMAT(QLIB_BUS_MODE_1_1_4, FALSE, TRUE),
+        QLIB_BUS_FORMAT(QLIB_BUS_MODE_1_4_4, FALSE, TRUE),
+        QLIB_BUS_FORMAT(QLIB_BUS_MODE_1_4_4, TRUE, TRUE),
+#ifdef QLIB_SUPPORT_QPI
+        QLIB_BUS_FORMAT(QLIB_BUS_MODE_4_4_4, FALSE, TRUE),
+        QLIB_BUS_FORMAT(QLIB_BUS_MODE_4_4_4, TRUE, TRUE),
+#endif
+    };
+    static const U8   qpiDummyCycles[] = {2, 4, 6, 8};
+    U8                reference[QLIB_BUS_TUNE_SIZE];
+    QLIB_STATUS_T     ret = QLIB_STATUS__OK;
+    QLIB_BUS_MODE_T   mode;
+    U8                dummyCycles;
+    U32               numDummyCycles;
+    U32               readTimeUs;
+    U32               f;
+    U32               d;
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+    U8 continuousReadEnabled = qlibContext->continuousReadEnabled;
+
+    // a corrupted mode byte could leave the flash in continuous read mode
+    qlibContext->continuousReadEnabled = FALSE;
+#endif
+
+    memset(busTune, 0, sizeof(QLIB_BUS_TUNE_T));
+    busTune->busFormat   = QLIB_BUS_FORMAT(qlibContext->busInterface.busMode, qlibContext->busInterface.dtr, TRUE);
+    busTune->dummyCycles = qlibContext->qpiReadDummyCycles;
+    busTune->readTimeUs  = MAX_U32;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Read the reference pattern in single SPI, tuning is skipped if the pattern is not readable          */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_BusTuneSet_L(qlibContext, formats[0], 0), ret, exit);
+    if (QLIB_STATUS__OK != QLIB_STD_Read(qlibContext, reference, QLIB_BUS_TUNE_ADDRESS, QLIB_BUS_TUNE_SIZE))
+    {
+        goto exit;
+    }
+    for (f = 1; f < QLIB_BUS_TUNE_SIZE && reference[f] == reference[0]; f++)
+        ;
+    if (QLIB_BUS_TUNE_SIZE == f)
+    {
+        goto exit;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Time the candidates, a candidate which fails to set or to read the pattern is skipped               */
+    /*-----------------------------------------------------------------------------------------------------*/
+    for (f = 0; f < ARRAY_SIZE(formats); f++)
+    {
+        mode           = QLIB_BUS_FORMAT_GET_MODE(formats[f]);
+#ifdef QLIB_STD_SFDP_ENABLED
+        // read modes and DTR which the device does not list in SFDP are not tried
+        if (TRUE == qlibContext->sfdp.valid &&
+            (!QLIB_SFDP_FAST_READ(&qlibContext->sfdp, mode) ||
+             (TRUE == QLIB_BUS_FORMAT_GET_DTR(formats[f]) && FALSE == qlibContext->sfdp.dtr)))
+        {
+            continue;
+        }
+#endif
+        numDummyCycles = (QLIB_BUS_MODE_4_4_4 == mode && FALSE == QLIB_BUS_FORMAT_GET_DTR(formats[f]))
+                             ? ARRAY_SIZE(qpiDummyCycles)
+                             : 1;
+
+        for (d = 0; d < numDummyCycles; d++)
+        {
+            dummyCycles = (1 < numDummyCycles) ? qpiDummyCycles[d] : 0;
+            busTune->candidates++;
+
+            if (QLIB_STATUS__OK != QLIB_BusTuneSet_L(qlibContext, formats[f], dummyCycles) ||
+                QLIB_STATUS__OK != QLIB_BusTuneRead_L(qlibContext, reference, &readTimeUs))
+            {
+                continue;
+            }
+
+            busTune->passed++;
+            if (readTimeUs < busTune->readTimeUs)
+            {
+                busTune->busFormat   = formats[f];
+                busTune->dummyCycles = dummyCycles;
+                busTune->readTimeUs  = readTimeUs;
+            }
+        }
+    }
+
+exit:
+    if (MAX_U32 == busTune->readTimeUs)
+    {
+        busTune->readTimeUs = 0;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Set the selected candidate, or restore the bus format if none passed                                */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (QLIB_STATUS__OK == ret)
+    {
+        ret = QLIB_BusTuneSet_L(qlibContext, busTune->busFormat, busTune->dummyCycles);
+    }
+    else
+    {
+        (void)QLIB_BusTuneSet_L(qlibContext, busTune->busFormat, busTune->dummyCycles);
+    }
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+    qlibContext->continuousReadEnabled = continuousReadEnabled;
+#endif
+
+    return ret;
+}
+
+/************************************************************************************************************
+* @brief       This routine sets the bus format and, in QPI, the read dummy cycles
+*
+* @param       qlibContext   qlib context object
+* @param[in]   busFormat     SPI bus format
+* @param[in]   dummyCycles   QPI read dummy cycles, 0 for the default dummy cycles
+*
+* @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_BusTuneSet_L(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_FORMAT_T busFormat, U8 dummyCycles)
+{
+    QLIB_STATUS_RET_CHECK(QLIB_SetInterface(qlibContext, busFormat));
+
+    if (QLIB_BUS_MODE_4_4_4 == QLIB_BUS_FORMAT_GET_MODE(busFormat))
+    {
+        QLIB_STATUS_RET_CHECK(QLIB_STD_SetReadParameters(qlibContext, dummyCycles));
+    }
+
+    return QLIB_STATUS__OK;
+}
+
+/************************************************************************************************************
+* @brief       This routine reads the pattern with the current bus format and compares it with the reference
+*
+* @param       qlibContext   qlib context object
+* @param[in]   reference     Pattern read in single SPI
+* @param[out]  readTimeUs    Total time of the pattern reads, in microseconds
+*
+* @return      0 if the pattern was read correctly, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_BusTuneRead_L(QLIB_CONTEXT_T* qlibContext, const U8* reference, U32* readTimeUs)
+{
+    U8  pattern[QLIB_BUS_TUNE_SIZE];
+    U32 start;
+    U32 i;
+    U32 j;
+
+    *readTimeUs = 0;
+
+    for (i = 0; i < QLIB_BUS_TUNE_READS; i++)
+    {
+        // a read which does not fill the buffer never matches the reference
+        for (j = 0; j < QLIB_BUS_TUNE_SIZE; j++)
+        {
+            pattern[j] = (U8)~reference[j];
+        }
+
+        start = PLAT_GetTimeUs();
+        QLIB_STATUS_RET_CHECK(QLIB_STD_Read(qlibContext, pattern, QLIB_BUS_TUNE_ADDRESS, QLIB_BUS_TUNE_SIZE));
+        *readTimeUs += PLAT_GetTimeUs() - start;
+
+        QLIB_ASSERT_RET(0 == memcmp(pattern, reference, QLIB_BUS_TUNE_SIZE), QLIB_STATUS__COMMUNICATION_ERR);
+    }
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_BUS_TUNE_ENABLED
+
@@ -133,6 +133,11 @@ QLIB_STATUS_T QLIB_InitLib(QLIB_CONTEXT_T* qlibContext);
  *  2. If the flash is in power down mode, the power down mode is released.\n
  *  3. If Multi-die chip includes flash with size over 128Mb, switch these dies to 4 bytes address mode.\n
  *
+ * When QLIB_BUS_TUNE_ENABLED is defined and @p busFormat is QLIB_BUS_FORMAT_AUTOTUNE, the fastest bus format
+ * which reads the pattern at QLIB_BUS_TUNE_ADDRESS correctly is selected, see @ref QLIB_BusTune_Get.
+ * QLIB_BUS_TUNE_ADDRESS must be plain readable. If the pattern can not be read, tuning is skipped and the
+ * current bus format and default QPI read dummy cycles are kept.
+ *
  * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
  * @param[in]   busFormat     Flash interface format, consists of bus mode and dtr.
  *
@@ -146,6 +151,30 @@ QLIB_STATUS_T QLIB_InitLib(QLIB_CONTEXT_T* qlibContext);
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_InitDevice(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_FORMAT_T busFormat);
 
+/************************************************************************************************************
+ * @brief       This function initializes the communication with W77Q using a previously exported state.
+ *
+ * This function is a fast alternative to @ref QLIB_InitDevice for application restarts while the flash
+ * kept running.\n
+ * The bus format and the device state (standard address size, sections layout, watchdog configuration and
+ * QPI read dummy cycles) stored in @p syncObject by @ref QLIB_ExportState are restored instead of auto-sensing
+ * the bus and reading them from the flash. The device is powered up, the restored state is range checked and
+ * validated by reading the Winbond ID once, and only then the secure module is synchronized after reset with a
+ * bounded wait. Non default QPI read dummy cycles are set again in the flash.\n
+ * If @p syncObject holds no device state, the validation fails or the secure module does not get ready, the
+ * function falls back to @ref QLIB_InitDevice with @ref QLIB_BUS_MODE_AUTOSENSE.\n
+ * The synchronization object must be re-exported after any flash configuration change.
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   syncObject    Synchronization object exported after @ref QLIB_InitDevice. NULL is not supported.
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p qlibContext or @p syncObject is NULL\n
+ * QLIB_STATUS__(ERROR)                 - Other error
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_InitDeviceFromState(QLIB_CONTEXT_T* qlibContext, const QLIB_SYNC_OBJ_T* syncObject);
+
 /************************************************************************************************************
  * @brief       This function establishes a communication channel with the flash and sets the active die to 0
  *
@@ -545,6 +574,61 @@ QLIB_STATUS_T QLIB_ConfigAccess(QLIB_CONTEXT_T* qlibContext, U32 sectionID, BOOL
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_Read(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID, U32 offset, U32 size, BOOL secure, BOOL auth);
 
+/************************************************************************************************************
+ * @brief       This function reads multiple ranges of one section from the flash
+ *
+ * Each range in @p ranges describes an offset in sectionId, an output buffer and a size.\n
+ * The arguments are checked once, and the status of each range is returned in its @p status field.
+ * Invalid ranges are skipped, the other ranges are still read.\n
+ * In secure mode, each page needed by the ranges is read once even if it is shared by several ranges,
+ * in ascending offset order, and consecutive pages are read in a single pipeline.\n
+ * If plain access is needed and it is not opened, it will be opened automatically by this routine.
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in,out] ranges      Array of read ranges. The status of each range is updated
+ * @param[in]   count         Number of ranges in @p ranges
+ * @param[in]   sectionID     [Section index](md_definitions.html#DEF_SECTION)
+ * @param[in]   secure        If TRUE then secure read, else standard read.
+ * @param[in]   auth          If TRUE performs authenticated read.
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                    - no error occurred in any range\n
+ * QLIB_STATUS__INVALID_PARAMETER         - @p qlibContext or @p ranges is NULL\n
+ * QLIB_STATUS__INVALID_PARAMETER         - @p sectionID is invalid in case of secure read\n
+ * QLIB_STATUS__PARAMETER_OUT_OF_RANGE    - @p sectionID > maximal section, according to the SECT_SEL in case of standard read\n
+ * QLIB_STATUS__PARAMETER_OUT_OF_RANGE    - @p count == 0\n
+ * QLIB_STATUS__NOT_SUPPORTED             - Standard read when QLIB_SEC_ONLY is defined\n
+ * QLIB_STATUS__(ERROR)                   - Status of the first failed range, see @ref QLIB_Read
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_ReadV(QLIB_CONTEXT_T* qlibContext, QLIB_READ_RANGE_T* ranges, U32 count, U32 sectionID, BOOL secure, BOOL auth);
+
+/************************************************************************************************************
+ * @brief       This function reads data from a section, selecting the read path automatically
+ *
+ * Reads of at least QLIB_READ_AUTO_PLAIN_THRESHOLD bytes from a section whose policy permits plain read are
+ * performed by standard reads, which are several times faster than secure reads. Smaller reads, and reads which
+ * can not be performed by standard reads, are performed by secure reads.\n
+ * If @p verify is TRUE, a standard read must cover the whole section (the active half of a rollback protected
+ * section) into a 32 bit aligned buffer, and it is verified by the section digest calculated by the device.
+ * Other verified reads are performed by authenticated secure reads.\n
+ * A session to the section must be open.
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[out]  buf           Pointer to output buffer
+ * @param[in]   sectionID     [Section index](md_definitions.html#DEF_SECTION)
+ * @param[in]   offset        [Section offset](md_definitions.html#DEF_OFFSET)
+ * @param[in]   size          Data size in bytes
+ * @param[in]   verify        If TRUE the read data is authenticated
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                    - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER         - @p qlibContext or @p buf is NULL\n
+ * QLIB_STATUS__INVALID_PARAMETER         - @p sectionID is invalid\n
+ * QLIB_STATUS__SECURITY_ERR              - The section digest does not match the read data, @p buf is cleared\n
+ * QLIB_STATUS__(ERROR)                   - Other error, see @ref QLIB_Read
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_ReadAuto(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID, U32 offset, U32 size, BOOL verify);
+
 /************************************************************************************************************
  * @brief       This function writes data to the flash
  *
@@ -578,6 +662,35 @@ QLIB_STATUS_T QLIB_Read(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID, U32
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_Write(QLIB_CONTEXT_T* qlibContext, const U8* buf, U32 sectionID, U32 offset, U32 size, BOOL secure);
 
+/************************************************************************************************************
+ * @brief       This function writes data gathered from multiple fragments to the flash
+ *
+ * The fragments in @p fragments are written one after the other to offset in sectionId, as if they were
+ * a single contiguous buffer.\n
+ * In secure mode, each page is built directly from the fragments, so no staging buffer is needed.\n
+ * If plain access is needed and it is not opened, it will be opened automatically by this routine.
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   fragments     Array of data fragments to write
+ * @param[in]   count         Number of fragments in @p fragments
+ * @param[in]   sectionID     [Section index](md_definitions.html#DEF_SECTION)
+ * @param[in]   offset        [Section offset](md_definitions.html#DEF_OFFSET)
+ * @param[in]   secure        If TRUE then secure write, else standard write.
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                    - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER         - @p qlibContext or @p fragments is NULL\n
+ * QLIB_STATUS__INVALID_PARAMETER         - Fragment buffer is NULL\n
+ * QLIB_STATUS__PARAMETER_OUT_OF_RANGE    - @p count == 0 or the total size of the fragments == 0\n
+ * QLIB_STATUS__(ERROR)                   - Other error, see @ref QLIB_Write
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_WriteV(QLIB_CONTEXT_T*              qlibContext,
+                          const QLIB_WRITE_FRAGMENT_T* fragments,
+                          U32                          count,
+                          U32                          sectionID,
+                          U32                          offset,
+                          BOOL                         secure);
+
 /************************************************************************************************************
  * @brief       This function erases the given memory range.
  *
@@ -636,6 +749,32 @@ QLIB_STATUS_T QLIB_Erase(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U32 offset,
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_EraseSection(QLIB_CONTEXT_T* qlibContext, U32 sectionID, BOOL secure);
 
+/************************************************************************************************************
+ * @brief       This function erases an erase plan, a list of memory ranges of one section.
+ *
+ * The ranges are sorted by offset, and adjacent and overlapping ranges are merged before erasing.\n
+ * If the merged ranges cover the whole section, a single section erase is performed as in
+ * @ref QLIB_EraseSection. Otherwise each merged range is erased as in @ref QLIB_Erase, with the largest
+ * legal erase units.\n
+ * All the ranges are checked before anything is erased.\n
+ * If plain access is needed and it is not opened, it will be opened automatically by this routine.
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in,out] ranges      Array of erase ranges. The array is sorted by offset in place
+ * @param[in]   count         Number of ranges in @p ranges
+ * @param[in]   sectionID     [Section index](md_definitions.html#DEF_SECTION)
+ * @param[in]   secure        If TRUE then secure erase, else standard erase.
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                    - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER         - @p qlibContext or @p ranges is NULL\n
+ * QLIB_STATUS__INVALID_PARAMETER         - @p sectionID is invalid\n
+ * QLIB_STATUS__PARAMETER_OUT_OF_RANGE    - @p count == 0, a range size == 0 or a range exceeds the section\n
+ * QLIB_STATUS__INVALID_DATA_ALIGNMENT    - A range offset or size is not aligned to sector size\n
+ * QLIB_STATUS__(ERROR)                   - Other error, see @ref QLIB_Erase and @ref QLIB_EraseSection
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_EraseV(QLIB_CONTEXT_T* qlibContext, QLIB_ERASE_RANGE_T* ranges, U32 count, U32 sectionID, BOOL secure);
+
 #ifndef QLIB_SEC_ONLY
 /************************************************************************************************************
  * @brief       This function suspends an ongoing erase or write operations.
@@ -707,6 +846,12 @@ QLIB_STATUS_T QLIB_ResetFlash(QLIB_CONTEXT_T* qlibContext);
  * @ref QLIB_PerformMaintenance should be called if mcMaintenance bit is set to 1 in reply.\n
  * Device reset is required if resetDevice bit is set to 1 in reply, as TC is close to its maximal value. (see also @ref QLIB_SEC_DMC_EOL_THRESHOLD)\n
  * If replaceDevice bit is set, the device is close to its End of Life and user should replace it. (see also @ref QLIB_SEC_TC_RESET_THRESHOLD)\n
+ * The notifications are derived from the SSR received by the last secure command and from the monotonic counters
+ * tracked in QLIB context, so no bus transaction is issued while they are valid.
+ * If QLIB_NOTIF_SSR_MAX_AGE_US is defined, the SSR is read again once the cached SSR is older than this value, or
+ * if no secure command captured it yet. The capture time is a U32 microsecond stamp of PLAT_GetTimeUs, which wraps
+ * after ~71 minutes. The age is computed by unsigned subtraction, so it is correct across the wrap as long as the
+ * SSR is captured again within this period.\n
  *
  * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
  * @param[out]  notifs        Bitmap of active notifications.
@@ -750,6 +895,34 @@ QLIB_STATUS_T QLIB_GetNotifications(QLIB_CONTEXT_T* qlibContext, QLIB_NOTIFICATI
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_PerformMaintenance(QLIB_CONTEXT_T* qlibContext);
 
+#ifdef QLIB_MAINT_SCHED_ENABLED
+/************************************************************************************************************
+ * @brief       This function performs QLIB maintenance in an idle window.
+ *
+ * The maintenance need is taken from the SSR received by the last secure command, so no status read is issued
+ * when the cached SSR is valid. If QLIB_NOTIF_SSR_MAX_AGE_US is defined, the SSR is read again once the cached SSR
+ * is older than this value. Maintenance iterations are performed only while the next iteration, according
+ * to the longest measured iteration time, fits in @p idleUs. Calling this function from the application idle
+ * loop keeps the maintenance off the critical path of later reads and session opens.\n
+ * Recommended flow:
+ * @code{.c}
+       BOOL pending;
+       QLIB_STATUS_RET_CHECK(QLIB_PerformMaintenanceIdle(qlibContext, idleWindowUs, &pending));
+ * @endcode
+ *
+ * @param[out]  qlibContext [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   idleUs      Idle window, in microseconds
+ * @param[out]  pending     TRUE if maintenance is still needed after the idle window
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p qlibContext or @p pending is NULL\n
+ * QLIB_STATUS__NOT_CONNECTED           - Need to connect using @ref QLIB_Connect function\n
+ * QLIB_STATUS__(ERROR)                 - Other error
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_PerformMaintenanceIdle(QLIB_CONTEXT_T* qlibContext, U32 idleUs, BOOL* pending);
+#endif // QLIB_MAINT_SCHED_ENABLED
+
 /************************************************************************************************************
  * @brief       This function forces an integrity check on a given section
  *
@@ -770,6 +943,26 @@ QLIB_STATUS_T QLIB_PerformMaintenance(QLIB_CONTEXT_T* qlibContext);
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_CheckIntegrity(QLIB_CONTEXT_T* qlibContext, U32 sectionID, QLIB_INTEGRITY_T integrityType);
 
+/************************************************************************************************************
+ * @brief       This function returns the section digest as calculated by the device over the section content
+ *
+ * The digest is returned by a single secure CALC_SIG command, so it can be compared with a host-calculated digest
+ * (see @ref QLIB_UTILS_CalcDigest) to verify the section content without reading it back.
+ *
+ * @param[out]  qlibContext     [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   sectionID       [Section index](md_definitions.html#DEF_SECTION)
+ * @param[out]  digest          Section digest
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p qlibContext or @p digest is NULL\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p sectionID is invalid\n
+ * QLIB_STATUS__DEVICE_SESSION_ERR      - Session is closed. Need to open session using @ref QLIB_OpenSession
+ * QLIB_STATUS__NOT_CONNECTED           - Need to perform connect using @ref QLIB_Connect function\n
+ * QLIB_STATUS__(ERROR)                 - Other error
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_CalcSectionDigest(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U64* digest);
+
 /************************************************************************************************************
  * @brief       This function calculates the CDI value.
  *
@@ -952,7 +1145,9 @@ void* QLIB_GetUserData(QLIB_CONTEXT_T* qlibContext);
  * @brief       This function generates a 'synchronization object' to synchronize between remote QLIB and TM layers
  *
  * This function generates a 'synchronization object' that is used to synchronize states between remote
- * QLIB and TM layers.
+ * QLIB and TM layers.\n
+ * If the device was initialized, the object also holds the sensed device state which can be used later
+ * by @ref QLIB_InitDeviceFromState to skip the device initialization flow.
  *
  * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
  * @param[out]  syncObject    Pointer to synchronization object to be filled with sync data. NULL is not supported.
@@ -982,6 +1177,178 @@ QLIB_STATUS_T QLIB_ExportState(QLIB_CONTEXT_T* qlibContext, QLIB_SYNC_OBJ_T* syn
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_ImportState(QLIB_CONTEXT_T* qlibContext, const QLIB_SYNC_OBJ_T* syncObject);
 
+#ifdef QLIB_SEC_READ_CACHE_SIZE
+/************************************************************************************************************
+ * @brief       This function enables or disables the secure read cache of a section
+ *
+ * When enabled, non-authenticated secure reads from the section are served from an LRU cache of
+ * QLIB_SEC_READ_CACHE_SIZE decrypted 32 bytes pages kept in the QLIB context.\n
+ * The cache is invalidated on any write, erase, section configuration, session close, reset or power
+ * transition. Evicted pages are zeroized.\n
+ * Caching can not be enabled for sections with plain write access, since their content may be changed
+ * without QLIB knowledge.\n
+ * Section configuration (@ref QLIB_ConfigSection, @ref QLIB_ConfigDevice, @ref QLIB_Format) disables the
+ * caching of the configured sections.
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   sectionID     Section index
+ * @param[in]   enable        TRUE to enable caching, FALSE to disable it
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p qlibContext is NULL or @p sectionID is out of range\n
+ * QLIB_STATUS__NOT_SUPPORTED           - section policy allows plain write access\n
+ * QLIB_STATUS__(ERROR)                 - Other error
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_ReadCache_Enable(QLIB_CONTEXT_T* qlibContext, U32 sectionID, BOOL enable);
+
+/************************************************************************************************************
+ * @brief       This function returns the secure read cache statistics
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[out]  hits          Number of 32 bytes pages read from cache. NULL is allowed.
+ * @param[out]  misses        Number of 32 bytes pages read from flash into cache. NULL is allowed.
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p qlibContext is NULL\n
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_ReadCache_GetStats(QLIB_CONTEXT_T* qlibContext, U32* hits, U32* misses);
+#endif // QLIB_SEC_READ_CACHE_SIZE
+
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+/************************************************************************************************************
+ * @brief       This function returns the learned completion times of program, erase and signature operations
+ *
+ * Each operation type (command and write data size) is reported with its average, minimum, maximum and
+ * percentiles of the completion time. Completion times growing over the device life indicate degraded flash.\n
+ * Up to QLIB_OP_TIME_MODEL_SIZE operation types are learned, an operation type which is not learned replaces
+ * the least measured one.
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[out]  stats         Statistics of up to @p maxEntries operation types
+ * @param[in]   maxEntries    Number of entries in @p stats
+ * @param[out]  numEntries    Number of learned operation types, can be larger than @p maxEntries
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p qlibContext or @p numEntries is NULL, or @p stats is NULL and
+ *                                        @p maxEntries is not 0\n
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_OpTimeModel_GetStats(QLIB_CONTEXT_T* qlibContext, QLIB_OP_TIME_STATS_T* stats, U32 maxEntries, U32* numEntries);
+
+/************************************************************************************************************
+ * @brief       This function clears the learned completion times, e.g. after the flash device is replaced
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p qlibContext is NULL\n
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_OpTimeModel_Reset(QLIB_CONTEXT_T* qlibContext);
+#endif // QLIB_OP_TIME_MODEL_SIZE
+
+#ifdef QLIB_IRQ_OFF_STATS_SIZE
+/************************************************************************************************************
+ * @brief       This function returns the longest interrupts masked window per command type
+ *
+ * Interrupts are masked only around the SPI sequences which send a command or read its response (QPI exit and
+ * enter, write enable, standard command, secure command write and read). Status polls and busy waits are
+ * performed with interrupts enabled. When QLIB_SUPPORT_XIP is defined interrupts are masked for the whole
+ * transaction.
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[out]  stats         Interrupts masked window statistics
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p qlibContext or @p stats is NULL\n
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_IrqOffStats_Get(QLIB_CONTEXT_T* qlibContext, QLIB_IRQ_OFF_STATS_T* stats);
+
+/************************************************************************************************************
+ * @brief       This function clears the interrupts masked window statistics
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p qlibContext is NULL\n
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_IrqOffStats_Reset(QLIB_CONTEXT_T* qlibContext);
+#endif // QLIB_IRQ_OFF_STATS_SIZE
+
+#ifdef QLIB_BUS_TUNE_ENABLED
+/************************************************************************************************************
+ * @brief       This function returns the bus format auto-tuning decision of @ref QLIB_InitDevice
+ *
+ * The decision may be persisted and set on the next initialization using @ref QLIB_BusTune_Apply, without
+ * tuning again.
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[out]  busTune       Selected bus format, QPI read dummy cycles and tuning statistics
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p qlibContext or @p busTune is NULL\n
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_BusTune_Get(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_TUNE_T* busTune);
+
+/************************************************************************************************************
+ * @brief       This function sets a bus format auto-tuning decision returned by @ref QLIB_BusTune_Get
+ *
+ * The device must be initialized. The QPI read dummy cycles are restored to the default by a flash reset.
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   busTune       Bus format auto-tuning decision
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                          - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER               - @p qlibContext or @p busTune is NULL\n
+ * QLIB_STATUS__SYSTEM_IN_INCORRECT_STATE       - the device is not initialized\n
+ * QLIB_STATUS__(ERROR)                         - Other error
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_BusTune_Apply(QLIB_CONTEXT_T* qlibContext, const QLIB_BUS_TUNE_T* busTune);
+#endif // QLIB_BUS_TUNE_ENABLED
+
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+/************************************************************************************************************
+ * @brief       This function enables or disables the continuous read mode of standard reads.
+ *
+ * When enabled, consecutive @ref QLIB_Read calls of plain data using dual or quad I/O fast read keep the flash
+ * in continuous read mode, so only the first read sends the instruction. The continuous read mode is exited
+ * before any other command. The flash status is not checked after reads performed in continuous read mode.
+ * Continuous read mode is disabled by default. The flash is taken out of a continuous read mode left by a previous
+ * host session by @ref QLIB_InitDevice and @ref QLIB_InitDeviceFromState.
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in]   enable        TRUE to enable continuous read mode, FALSE to disable it
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p qlibContext is NULL\n
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_ContinuousRead_Enable(QLIB_CONTEXT_T* qlibContext, BOOL enable);
+#endif // QLIB_STD_CONTINUOUS_READ_ENABLED
+
+#ifdef QLIB_STD_SFDP_ENABLED
+/************************************************************************************************************
+ * @brief       This function returns the device parameters discovered from SFDP by @ref QLIB_InitDevice
+ *
+ * The erase types and typical times are used for erase planning and for the first polling delays of erase and
+ * program operations. If the parameters are not valid, the compile-time configuration is used.
+ *
+ * @param[out]  qlibContext   [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[out]  sfdp          Discovered device parameters
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p qlibContext or @p sfdp is NULL\n
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_GetSfdp(QLIB_CONTEXT_T* qlibContext, QLIB_SFDP_T* sfdp);
+#endif // QLIB_STD_SFDP_ENABLED
+
 /************************************************************************************************************
  * @brief       This function returns QLIB version
  *
@@ -104,12 +104,26 @@
 #define QLIB_CMD_PROC__OP0_busy_wait(qlibContext)                 QLIB_CMD_PROC_execute_sec_cmd_write_read(qlibContext, 0, NULL, 0, NULL, 0)
 #define QLIB_CMD_PROC__OP0_busy_wait_OP2(qlibContext, data, size) QLIB_CMD_PROC_execute_sec_cmd_read(qlibContext, 0, data, size)
 
+#ifdef QLIB_SPI_ASYNC_ENABLED
+#define QLIB_CMD_PROC__OP0_busy_wait_OP2_start(qlibContext, data, size) \
+    QLIB_TM_Secure_ReadStart(qlibContext, data, size, &(qlibContext)->ssr)
+#define QLIB_CMD_PROC__OP2_wait(qlibContext) QLIB_TM_Secure_ReadWait(qlibContext)
+#endif // QLIB_SPI_ASYNC_ENABLED
+
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                       LOCAL FUNCTION DECLARATIONS                                       */
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 static QLIB_STATUS_T QLIB_CMD_PROC_use_mc_L(QLIB_CONTEXT_T* qlibContext, _64BIT mc);
+#ifndef QLIB_SUPPORT_XIP
+static QLIB_STATUS_T QLIB_CMD_PROC__SRD_Multi_L(QLIB_CONTEXT_T* qlibContext,
+                                                U32             addr,
+                                                U32*            data,
+                                                U32             size,
+                                                BOOL            started,
+                                                BOOL            readAhead);
+#endif // QLIB_SUPPORT_XIP
 static QLIB_STATUS_T QLIB_CMD_PROC_refresh_ssk_L(QLIB_CONTEXT_T* qlibContext);
 
 static QLIB_STATUS_T QLIB_CMD_PROC__sign_data_L(QLIB_CONTEXT_T* qlibContext,
@@ -1056,117 +1070,17 @@ QLIB_STATUS_T QLIB_CMD_PROC__SARD(QLIB_CONTEXT_T* qlibContext, U32 addr, U32* da
 #ifndef QLIB_SUPPORT_XIP
 QLIB_STATUS_T QLIB_CMD_PROC__SRD_Multi(QLIB_CONTEXT_T* qlibContext, U32 addr, U32* data, U32 size)
 {
-    QLIB_CRYPTO_CONTEXT_T* cryptContext_old = NULL;
-    QLIB_CRYPTO_CONTEXT_T* cryptContext_new = NULL;
-    QLIB_STATUS_T          ret              = QLIB_STATUS__SECURITY_ERR;
-    U32                    enc_addr         = 0;
-    U32                    rand             = 0;
-
-    /*-----------------------------------------------------------------------------------------------------*/
-    /* Build decryption cipher key                                                                         */
-    /*-----------------------------------------------------------------------------------------------------*/
-    QLIB_CMD_PROC_initialize_decryption_key(qlibContext, cryptContext_old);
-
-    /*-----------------------------------------------------------------------------------------------------*/
-    /* Randomize address                                                                                   */
-    /*-----------------------------------------------------------------------------------------------------*/
-    rand = QLIB_CRYPTO_GetRandBits(&qlibContext->prng, LOG2(QLIB_SEC_READ_PAGE_SIZE_BYTE));
-    addr = addr ^ rand;
-
-    /*-----------------------------------------------------------------------------------------------------*/
-    /* Encrypt address                                                                                     */
-    /*-----------------------------------------------------------------------------------------------------*/
-    QLIB_CMD_PROC_encrypt_address(enc_addr, addr, cryptContext_old->cipherKey);
-
-    /*-----------------------------------------------------------------------------------------------------*/
-    /* Start read transaction (non-blocking)                                                               */
-    /*-----------------------------------------------------------------------------------------------------*/
-    QLIB_STATUS_RET_CHECK(QLIB_CMD_PROC__OP1_only(qlibContext, QLIB_CMD_PROC__MAKE_CTAG_ADDR(QLIB_CMD_SEC_SRD, enc_addr)));
-
-    do
-    {
-        if (size > QLIB_SEC_READ_PAGE_SIZE_BYTE)
-        {
-            /*---------------------------------------------------------------------------------------------*/
-            /* Build next cipher without advancing TC (in case it is not used)                             */
-            /*---------------------------------------------------------------------------------------------*/
-            QLIB_KEY_MNGR__CMD_CONTEXT_ADVANCE(qlibContext);
-            cryptContext_new = &QLIB_KEY_MNGR__CMD_CONTEXT_GET(qlibContext);
-            QLIB_CMD_PROC_update_decryption_key_async(qlibContext, cryptContext_new);
-
-            /*---------------------------------------------------------------------------------------------*/
-            /* Generate random                                                                             */
-            /*---------------------------------------------------------------------------------------------*/
-            rand = QLIB_CRYPTO_GetRandBits(&qlibContext->prng, LOG2(QLIB_SEC_READ_PAGE_SIZE_BYTE));
-
-            /*---------------------------------------------------------------------------------------------*/
-            /* Calculate next address                                                                      */
-            /*---------------------------------------------------------------------------------------------*/
-            addr += QLIB_SEC_READ_PAGE_SIZE_BYTE;
-            addr = addr ^ rand;
-
-            /*---------------------------------------------------------------------------------------------*/
-            /* Increment TC                                                                                */
-            /*---------------------------------------------------------------------------------------------*/
-            QLIB_TRANSACTION_CNTR_USE(qlibContext);
-        }
-
-        /*-------------------------------------------------------------------------------------------------*/
-        /* Wait while busy, check for errors and read data                                                 */
-        /*-------------------------------------------------------------------------------------------------*/
-        ret = QLIB_CMD_PROC__OP0_busy_wait_OP2(qlibContext,
-                                               QLIB_HASH_BUF_GET__READ_PAGE(cryptContext_old->hashBuf),
-                                               sizeof(U32) + QLIB_SEC_READ_PAGE_SIZE_BYTE);
-
-        /*-------------------------------------------------------------------------------------------------*/
-        /* Start next command                                                                              */
-        /*-------------------------------------------------------------------------------------------------*/
-        if (size > QLIB_SEC_READ_PAGE_SIZE_BYTE)
-        {
-            /*---------------------------------------------------------------------------------------------*/
-            /* Wait till cipher is ready                                                                   */
-            /*---------------------------------------------------------------------------------------------*/
-            QLIB_CMD_PROC_update_decryption_key_async_wait_till_ready(qlibContext);
-
-            /*---------------------------------------------------------------------------------------------*/
-            /* Encrypt next address                                                                        */
-            /*---------------------------------------------------------------------------------------------*/
-            QLIB_CMD_PROC_encrypt_address(enc_addr, addr, cryptContext_new->cipherKey);
-
-            /*---------------------------------------------------------------------------------------------*/
-            /* Start next read transaction (non-blocking)                                                  */
-            /*---------------------------------------------------------------------------------------------*/
-            QLIB_STATUS_RET_CHECK(
-                QLIB_CMD_PROC__OP1_only(qlibContext, QLIB_CMD_PROC__MAKE_CTAG_ADDR(QLIB_CMD_SEC_SRD, enc_addr)));
-        }
-
-        /*-------------------------------------------------------------------------------------------------*/
-        /* Check errors after starting new command                                                         */
-        /*-------------------------------------------------------------------------------------------------*/
-        QLIB_STATUS_RET_CHECK(QLIB_CMD_PROC__checkLastSsrErrors(qlibContext, SSR_MASK__ALL_ERRORS));
-        QLIB_STATUS_RET_CHECK(ret);
-
-        /*-------------------------------------------------------------------------------------------------*/
-        /* Decrypt with old cipher                                                                         */
-        /*-------------------------------------------------------------------------------------------------*/
-        QLIB_CRYPTO_EncryptData_INLINE(data, QLIB_HASH_BUF_GET__DATA(cryptContext_old->hashBuf), cryptContext_old->cipherKey, 8);
-
-        /*-------------------------------------------------------------------------------------------------*/
-        /* Update variables                                                                                */
-        /*-------------------------------------------------------------------------------------------------*/
-        if (size > QLIB_SEC_READ_PAGE_SIZE_BYTE)
-        {
-            data += QLIB_SEC_READ_PAGE_SIZE_BYTE / sizeof(U32);
-            size -= QLIB_SEC_READ_PAGE_SIZE_BYTE;
-            cryptContext_old = cryptContext_new;
-        }
-        else
-        {
-            size = 0; // exit loop
-        }
-    } while (size);
+    return QLIB_CMD_PROC__SRD_Multi_L(qlibContext, addr, data, size, FALSE, FALSE);
+}
 
-    return QLIB_STATUS__OK;
+QLIB_STATUS_T QLIB_CMD_PROC__SRD_Multi_ReadAhead(QLIB_CONTEXT_T* qlibContext,
+                                                 U32             addr,
+                                                 U32*            data,
+                                                 U32             size,
+                                                 BOOL            started,
+                                                 BOOL            readAhead)
+{
+    return QLIB_CMD_PROC__SRD_Multi_L(qlibContext, addr, data, size, started, readAhead);
 }
 
 QLIB_STATUS_T QLIB_CMD_PROC__SARD_Multi(QLIB_CONTEXT_T* qlibContext, U32 addr, U32* data, U32 size)
@@ -1199,6 +1113,15 @@ QLIB_STATUS_T QLIB_CMD_PROC__SARD_Multi(QLIB_CONTEXT_T* qlibContext, U32 addr, U
 
     do
     {
+#ifdef QLIB_SPI_ASYNC_ENABLED
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Wait while busy and start reading data, next cipher is built while the data is transferred      */
+        /*-------------------------------------------------------------------------------------------------*/
+        ret = QLIB_CMD_PROC__OP0_busy_wait_OP2_start(qlibContext,
+                                                     QLIB_HASH_BUF_GET__READ_PAGE(cryptContext_old->hashBuf),
+                                                     sizeof(U32) + QLIB_SEC_READ_PAGE_SIZE_BYTE + sizeof(U64));
+#endif // QLIB_SPI_ASYNC_ENABLED
+
         if (size > QLIB_SEC_READ_PAGE_SIZE_BYTE)
         {
             /*---------------------------------------------------------------------------------------------*/
@@ -1225,12 +1148,19 @@ QLIB_STATUS_T QLIB_CMD_PROC__SARD_Multi(QLIB_CONTEXT_T* qlibContext, U32 addr, U
             QLIB_TRANSACTION_CNTR_USE(qlibContext);
         }
 
+#ifdef QLIB_SPI_ASYNC_ENABLED
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Wait till data is read                                                                          */
+        /*-------------------------------------------------------------------------------------------------*/
+        ret = (QLIB_STATUS__OK == ret) ? QLIB_CMD_PROC__OP2_wait(qlibContext) : ret;
+#else
         /*-------------------------------------------------------------------------------------------------*/
         /* Wait while busy, check for errors and read data                                                 */
         /*-------------------------------------------------------------------------------------------------*/
         ret = QLIB_CMD_PROC__OP0_busy_wait_OP2(qlibContext,
                                                QLIB_HASH_BUF_GET__READ_PAGE(cryptContext_old->hashBuf),
                                                sizeof(U32) + QLIB_SEC_READ_PAGE_SIZE_BYTE + sizeof(U64));
+#endif // QLIB_SPI_ASYNC_ENABLED
 
         /*-------------------------------------------------------------------------------------------------*/
         /* Start next command                                                                              */
@@ -1728,3 +1658,184 @@ QLIB_STATUS_T QLIB_CMD_PROC__execute_signed_setter_L(QLIB_CONTEXT_T* qlibContext
     /*-----------------------------------------------------------------------------------------------------*/
     return QLIB_CMD_PROC_execute_sec_cmd_write(qlibContext, ctag, dataOutBuf, data_size + sizeof(_64BIT));
 }
+
+#ifndef QLIB_SUPPORT_XIP
+/************************************************************************************************************
+ * @brief       This routine performs multi-block secure read. The SRD of the next page is started before
+ *              the current page is decrypted.
+ *
+ * @param[in,out]   qlibContext   Context
+ * @param[in]       addr          Address
+ * @param[out]      data          Read data buffer
+ * @param[in]       size          Read data size in bytes
+ * @param[in]       started       TRUE if the SRD of the first page is already in flight (read-ahead),
+ *                                started with the current command context
+ * @param[in]       readAhead     TRUE to start the SRD of the page following the read data and leave it in flight
+ *
+ * @return      QLIB_STATUS__OK on success or QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_CMD_PROC__SRD_Multi_L(QLIB_CONTEXT_T* qlibContext,
+                                                U32             addr,
+                                                U32*            data,
+                                                U32             size,
+                                                BOOL            started,
+                                                BOOL            readAhead)
+{
+    QLIB_CRYPTO_CONTEXT_T* cryptContext_old = NULL;
+    QLIB_CRYPTO_CONTEXT_T* cryptContext_new = NULL;
+    QLIB_STATUS_T          ret              = QLIB_STATUS__SECURITY_ERR;
+    QLIB_STATUS_T          status           = QLIB_STATUS__OK;
+    U32                    enc_addr         = 0;
+    U32                    rand             = 0;
+    BOOL                   startNext        = FALSE;
+
+    if (TRUE == started)
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* First read transaction is already in flight with the current cipher                             */
+        /*-------------------------------------------------------------------------------------------------*/
+        cryptContext_old = &QLIB_KEY_MNGR__CMD_CONTEXT_GET(qlibContext);
+    }
+    else
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Build decryption cipher key                                                                     */
+        /*-------------------------------------------------------------------------------------------------*/
+        QLIB_CMD_PROC_initialize_decryption_key(qlibContext, cryptContext_old);
+
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Randomize address                                                                               */
+        /*-------------------------------------------------------------------------------------------------*/
+        rand = QLIB_CRYPTO_GetRandBits(&qlibContext->prng, LOG2(QLIB_SEC_READ_PAGE_SIZE_BYTE));
+        addr = addr ^ rand;
+
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Encrypt address                                                                                 */
+        /*-------------------------------------------------------------------------------------------------*/
+        QLIB_CMD_PROC_encrypt_address(enc_addr, addr, cryptContext_old->cipherKey);
+
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Start read transaction (non-blocking)                                                           */
+        /*-------------------------------------------------------------------------------------------------*/
+        QLIB_STATUS_RET_CHECK(QLIB_CMD_PROC__OP1_only(qlibContext, QLIB_CMD_PROC__MAKE_CTAG_ADDR(QLIB_CMD_SEC_SRD, enc_addr)));
+    }
+
+    do
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Next page is read if data remains or if read-ahead is requested after the last page             */
+        /*-------------------------------------------------------------------------------------------------*/
+        startNext = ((size > QLIB_SEC_READ_PAGE_SIZE_BYTE) || (TRUE == readAhead)) ? TRUE : FALSE;
+
+#ifdef QLIB_SPI_ASYNC_ENABLED
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Wait while busy and start reading data, next cipher is built while the data is transferred      */
+        /*-------------------------------------------------------------------------------------------------*/
+        ret = QLIB_CMD_PROC__OP0_busy_wait_OP2_start(qlibContext,
+                                                     QLIB_HASH_BUF_GET__READ_PAGE(cryptContext_old->hashBuf),
+                                                     sizeof(U32) + QLIB_SEC_READ_PAGE_SIZE_BYTE);
+#endif // QLIB_SPI_ASYNC_ENABLED
+
+        if (TRUE == startNext)
+        {
+
+            /*---------------------------------------------------------------------------------------------*/
+            /* Build next cipher without advancing TC (in case it is not used)                             */
+            /*---------------------------------------------------------------------------------------------*/
+            QLIB_KEY_MNGR__CMD_CONTEXT_ADVANCE(qlibContext);
+            cryptContext_new = &QLIB_KEY_MNGR__CMD_CONTEXT_GET(qlibContext);
+            QLIB_CMD_PROC_update_decryption_key_async(qlibContext, cryptContext_new);
+
+            /*---------------------------------------------------------------------------------------------*/
+            /* Generate random                                                                             */
+            /*---------------------------------------------------------------------------------------------*/
+            rand = QLIB_CRYPTO_GetRandBits(&qlibContext->prng, LOG2(QLIB_SEC_READ_PAGE_SIZE_BYTE));
+
+            /*---------------------------------------------------------------------------------------------*/
+            /* Calculate next address                                                                      */
+            /*---------------------------------------------------------------------------------------------*/
+            addr += QLIB_SEC_READ_PAGE_SIZE_BYTE;
+            addr = addr ^ rand;
+
+            /*---------------------------------------------------------------------------------------------*/
+            /* Increment TC                                                                                */
+            /*---------------------------------------------------------------------------------------------*/
+            QLIB_TRANSACTION_CNTR_USE(qlibContext);
+        }
+
+#ifdef QLIB_SPI_ASYNC_ENABLED
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Wait till data is read                                                                          */
+        /*-------------------------------------------------------------------------------------------------*/
+        ret = (QLIB_STATUS__OK == ret) ? QLIB_CMD_PROC__OP2_wait(qlibContext) : ret;
+#else
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Wait while busy, check for errors and read data                                                 */
+        /*-------------------------------------------------------------------------------------------------*/
+        ret = QLIB_CMD_PROC__OP0_busy_wait_OP2(qlibContext,
+                                               QLIB_HASH_BUF_GET__READ_PAGE(cryptContext_old->hashBuf),
+                                               sizeof(U32) + QLIB_SEC_READ_PAGE_SIZE_BYTE);
+#endif // QLIB_SPI_ASYNC_ENABLED
+
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Start next command                                                                              */
+        /*-------------------------------------------------------------------------------------------------*/
+        if (TRUE == startNext)
+        {
+            /*---------------------------------------------------------------------------------------------*/
+            /* Wait till cipher is ready                                                                   */
+            /*---------------------------------------------------------------------------------------------*/
+            QLIB_CMD_PROC_update_decryption_key_async_wait_till_ready(qlibContext);
+
+            /*---------------------------------------------------------------------------------------------*/
+            /* Encrypt next address                                                                        */
+            /*---------------------------------------------------------------------------------------------*/
+            QLIB_CMD_PROC_encrypt_address(enc_addr, addr, cryptContext_new->cipherKey);
+
+            /*---------------------------------------------------------------------------------------------*/
+            /* Start next read transaction (non-blocking)                                                  */
+            /*---------------------------------------------------------------------------------------------*/
+            QLIB_STATUS_RET_CHECK(
+                QLIB_CMD_PROC__OP1_only(qlibContext, QLIB_CMD_PROC__MAKE_CTAG_ADDR(QLIB_CMD_SEC_SRD, enc_addr)));
+        }
+
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Check errors after starting new command                                                         */
+        /*-------------------------------------------------------------------------------------------------*/
+        status = QLIB_CMD_PROC__checkLastSsrErrors(qlibContext, SSR_MASK__ALL_ERRORS);
+        ret    = (QLIB_STATUS__OK != status) ? status : ret;
+        if (QLIB_STATUS__OK != ret)
+        {
+            /*---------------------------------------------------------------------------------------------*/
+            /* Drain the read started for the next page, so the next command finds the flash ready        */
+            /*---------------------------------------------------------------------------------------------*/
+            if (TRUE == startNext)
+            {
+                (void)QLIB_CMD_PROC__OP0_busy_wait(qlibContext);
+            }
+            return ret;
+        }
+
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Decrypt with old cipher                                                                         */
+        /*-------------------------------------------------------------------------------------------------*/
+        QLIB_CRYPTO_EncryptData_INLINE(data, QLIB_HASH_BUF_GET__DATA(cryptContext_old->hashBuf), cryptContext_old->cipherKey, 8);
+
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Update variables                                                                                */
+        /*-------------------------------------------------------------------------------------------------*/
+        if (size > QLIB_SEC_READ_PAGE_SIZE_BYTE)
+        {
+            data += QLIB_SEC_READ_PAGE_SIZE_BYTE / sizeof(U32);
+            size -= QLIB_SEC_READ_PAGE_SIZE_BYTE;
+            cryptContext_old = cryptContext_new;
+        }
+        else
+        {
+            size = 0; // exit loop
+        }
+    } while (size);
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_SUPPORT_XIP
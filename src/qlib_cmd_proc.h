@@ -563,6 +563,26 @@ QLIB_STATUS_T QLIB_CMD_PROC__SARD(QLIB_CONTEXT_T* qlibContext, U32 addr, U32* da
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_CMD_PROC__SRD_Multi(QLIB_CONTEXT_T* qlibContext, U32 addr, U32* data, U32 size);
 
+/************************************************************************************************************
+ * @brief       This routine performs multi-block secure read which may continue a read-ahead and may leave
+ *              the read of the next page in flight
+ *
+ * @param[in,out]   qlibContext   Context
+ * @param[in]       addr          Address
+ * @param[out]      data          Read data buffer
+ * @param[in]       size          Read data size in bytes
+ * @param[in]       started       TRUE if the read of the page at @p addr was left in flight by previous read-ahead
+ * @param[in]       readAhead     TRUE to start the read of the page at @p addr + @p size and leave it in flight
+ *
+ * @return      QLIB_STATUS__OK on success or QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_CMD_PROC__SRD_Multi_ReadAhead(QLIB_CONTEXT_T* qlibContext,
+                                                 U32             addr,
+                                                 U32*            data,
+                                                 U32             size,
+                                                 BOOL            started,
+                                                 BOOL            readAhead);
+
 /************************************************************************************************************
  * @brief       This routine performs multi-block secure authenticated read
  *
@@ -130,6 +130,9 @@ typedef enum QLIB_BUS_MODE_T
     QLIB_BUS_MODE_1_4_4   = Q2_SEC_INST__QUAD | 0x5,   ///< Single SPI for command, Quad SPI for address and Quad SPI for data
     QLIB_BUS_MODE_4_4_4   = Q2_SEC_INST__QUAD | 0x6,   ///< Quad SPI for command, Quad SPI for address and Quad SPI for data
     QLIB_BUS_MODE_AUTOSENSE,                           ///< Autosense
+#ifdef QLIB_BUS_TUNE_ENABLED
+    QLIB_BUS_MODE_AUTOTUNE, ///< Autosense and select the fastest bus format
+#endif
 } QLIB_BUS_MODE_T;
 
 /************************************************************************************************************
@@ -221,10 +224,53 @@ typedef U32 QLIB_BUS_FORMAT_T;
 #define QLIB_BUS_FORMAT(mode, dtr, enter_exit_qpi) \
     MAKE_32_BIT((mode), ((dtr) == TRUE ? 1 : 0), ((enter_exit_qpi) == TRUE ? 1 : 0), 0)
 #define QLIB_BUS_FORMAT_AUTOSENSE                     QLIB_BUS_FORMAT(QLIB_BUS_MODE_AUTOSENSE, FALSE, TRUE)
+#ifdef QLIB_BUS_TUNE_ENABLED
+#define QLIB_BUS_FORMAT_AUTOTUNE QLIB_BUS_FORMAT(QLIB_BUS_MODE_AUTOTUNE, FALSE, TRUE)
+#endif
 #define QLIB_BUS_FORMAT_GET_MODE(busFormat)           ((QLIB_BUS_MODE_T)BYTE((busFormat), 0))
 #define QLIB_BUS_FORMAT_GET_DTR(busFormat)            (1 == BYTE((busFormat), 1) ? TRUE : FALSE)
 #define QLIB_BUS_FORMAT_GET_ENTER_EXIT_QPI(busFormat) (1 == BYTE((busFormat), 2) ? TRUE : FALSE)
 
+#ifdef QLIB_BUS_TUNE_ENABLED
+#ifdef QLIB_SEC_ONLY
+#error "QLIB_BUS_TUNE_ENABLED requires the standard flash commands, QLIB_SEC_ONLY must not be defined"
+#endif
+
+/************************************************************************************************************
+ * Bus format auto-tuning decision
+************************************************************************************************************/
+typedef struct QLIB_BUS_TUNE_T
+{
+    QLIB_BUS_FORMAT_T busFormat;   ///< Selected bus format
+    U8                dummyCycles; ///< Selected QPI read dummy cycles, 0 if the default dummy cycles are used
+    U8                candidates;  ///< Number of tested bus format and dummy cycles candidates
+    U8                passed;      ///< Number of candidates which read the pattern correctly
+    U32               readTimeUs;  ///< Pattern read time of the selected candidate, in microseconds
+} QLIB_BUS_TUNE_T;
+#endif // QLIB_BUS_TUNE_ENABLED
+
+#ifdef QLIB_STD_SFDP_ENABLED
+#define QLIB_SFDP_ERASE_TYPES              4
+#define QLIB_SFDP_FAST_READ_BIT(busMode)   ((U8)(1u << ((U32)(busMode)&0x0F)))
+#define QLIB_SFDP_FAST_READ(sfdp, busMode) (0 != ((sfdp)->fastReadModes & QLIB_SFDP_FAST_READ_BIT(busMode)))
+
+/************************************************************************************************************
+ * Device parameters discovered from the SFDP JEDEC basic flash parameter table
+************************************************************************************************************/
+typedef struct QLIB_SFDP_T
+{
+    U8  valid;                                     ///< TRUE if the parameter table was found and parsed
+    U8  fastReadModes;                             ///< Supported read modes, @ref QLIB_SFDP_FAST_READ_BIT of each mode
+    U8  dtr;                                       ///< TRUE if DTR reads are supported
+    U8  eraseCmd[QLIB_SFDP_ERASE_TYPES];           ///< Erase type instructions
+    U32 eraseSize[QLIB_SFDP_ERASE_TYPES];          ///< Erase type sizes in bytes, 0 if the erase type is not supported
+    U32 eraseTypicalUs[QLIB_SFDP_ERASE_TYPES];     ///< Erase type typical times in microseconds, 0 if unknown
+    U32 chipEraseTypicalUs;                        ///< Chip erase typical time in microseconds, 0 if unknown
+    U32 pageSize;                                  ///< Page size in bytes, 0 if unknown
+    U32 pageProgramTypicalUs;                      ///< Page program typical time in microseconds, 0 if unknown
+} QLIB_SFDP_T;
+#endif // QLIB_STD_SFDP_ENABLED
+
 /************************************************************************************************************
  * swap type
 ************************************************************************************************************/
@@ -568,6 +614,150 @@ typedef struct QLIB_RESET_STATUS_T
     U32 watchdogReset : 1;     // 1==Watchdog reset occurred
 } QLIB_RESET_STATUS_T;
 
+#ifdef QLIB_SEC_READ_CACHE_SIZE
+/************************************************************************************************************
+ * Secure read cache entry
+************************************************************************************************************/
+typedef struct QLIB_SEC_READ_CACHE_ENTRY_T
+{
+    U32 data[QLIB_SEC_READ_PAGE_SIZE_BYTE / sizeof(U32)]; ///< Decrypted page data
+    U32 offset;                                           ///< Page offset in section
+    U32 lastUse;                                          ///< Access tick of last use, for LRU replacement
+    U8  sectionID;                                        ///< Section index
+    U8  valid;                                            ///< Entry holds valid data
+} QLIB_SEC_READ_CACHE_ENTRY_T;
+
+/************************************************************************************************************
+ * Secure read cache
+************************************************************************************************************/
+typedef struct QLIB_SEC_READ_CACHE_T
+{
+    QLIB_SEC_READ_CACHE_ENTRY_T entries[QLIB_SEC_READ_CACHE_SIZE]; ///< Cached pages
+    U32                         tick;                              ///< Access tick counter
+    U32                         hits;                              ///< Number of pages read from cache
+    U32                         misses;                            ///< Number of pages read from flash into cache
+    U8                          sectionsEnabled;                   ///< Bit per section, set if caching is enabled
+} QLIB_SEC_READ_CACHE_T;
+#endif // QLIB_SEC_READ_CACHE_SIZE
+
+#ifdef QLIB_SEC_READ_AHEAD_ENABLED
+/************************************************************************************************************
+ * Secure sequential read-ahead state
+************************************************************************************************************/
+typedef struct QLIB_SEC_READ_AHEAD_T
+{
+    U32 offset;    ///< Section offset expected by the next sequential read
+    U8  sectionID; ///< Section index of the sequential read stream
+    U8  pending;   ///< Secure read of the page at offset is in flight
+} QLIB_SEC_READ_AHEAD_T;
+#endif // QLIB_SEC_READ_AHEAD_ENABLED
+
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+/************************************************************************************************************
+ * Operation time model definitions
+************************************************************************************************************/
+#define QLIB_OP_TIME_HISTOGRAM_SIZE 28 ///< Number of log2 buckets of the completion time, up to 2^28 microseconds
+#define QLIB_OP_TIME_EWMA_SHIFT     3  ///< Average weight of the last completion time is 2^-QLIB_OP_TIME_EWMA_SHIFT
+#define QLIB_OP_TIME_MIN_SAMPLES    4  ///< Completions measured before the first status poll is delayed
+
+/************************************************************************************************************
+ * Operation time model entry, learned completion time of a single operation type
+************************************************************************************************************/
+typedef struct QLIB_OP_TIME_ENTRY_T
+{
+    U32 ewma;                                   ///< Average completion time in microseconds, scaled by 2^QLIB_OP_TIME_EWMA_SHIFT
+    U32 minUs;                                  ///< Shortest completion time in microseconds
+    U32 maxUs;                                  ///< Longest completion time in microseconds
+    U32 count;                                  ///< Number of completions measured
+    U16 histogram[QLIB_OP_TIME_HISTOGRAM_SIZE]; ///< Completion times, bucket i holds [2^i, 2^(i+1)) microseconds
+    U16 size;                                   ///< Write data size in bytes, 0 for commands without data
+    U8  cmd;                                    ///< SPI command, or secure command if secure is set
+    U8  secure;                                 ///< Secure command indication
+} QLIB_OP_TIME_ENTRY_T;
+
+/************************************************************************************************************
+ * Operation time model
+************************************************************************************************************/
+typedef struct QLIB_OP_TIME_MODEL_T
+{
+    QLIB_OP_TIME_ENTRY_T entries[QLIB_OP_TIME_MODEL_SIZE]; ///< Learned operation types
+} QLIB_OP_TIME_MODEL_T;
+
+/************************************************************************************************************
+ * Operation time statistics, returned by @ref QLIB_OpTimeModel_GetStats
+************************************************************************************************************/
+typedef struct QLIB_OP_TIME_STATS_T
+{
+    U32 count;  ///< Number of completions measured
+    U32 avgUs;  ///< Exponentially weighted average completion time in microseconds
+    U32 minUs;  ///< Shortest completion time in microseconds
+    U32 maxUs;  ///< Longest completion time in microseconds
+    U32 p50Us;  ///< Median completion time in microseconds
+    U32 p90Us;  ///< 90th percentile completion time in microseconds
+    U32 p99Us;  ///< 99th percentile completion time in microseconds
+    U16 size;   ///< Write data size in bytes, 0 for commands without data
+    U8  cmd;    ///< SPI command, or secure command if secure is set (QLIB_CMD_SEC_NONE for a response read only)
+    U8  secure; ///< Secure command indication
+} QLIB_OP_TIME_STATS_T;
+#endif // QLIB_OP_TIME_MODEL_SIZE
+
+#ifdef QLIB_IRQ_OFF_STATS_SIZE
+/************************************************************************************************************
+ * Interrupts masked window statistics of a single command type
+************************************************************************************************************/
+typedef struct QLIB_IRQ_OFF_ENTRY_T
+{
+    U32 maxUs;  ///< Longest interrupts masked window in microseconds
+    U32 count;  ///< Number of transactions
+    U8  cmd;    ///< SPI command, or secure command if secure is set (QLIB_CMD_SEC_NONE for a response read only)
+    U8  secure; ///< Secure command indication
+} QLIB_IRQ_OFF_ENTRY_T;
+
+/************************************************************************************************************
+ * Interrupts masked window statistics, returned by @ref QLIB_IrqOffStats_Get
+************************************************************************************************************/
+typedef struct QLIB_IRQ_OFF_STATS_T
+{
+    QLIB_IRQ_OFF_ENTRY_T entries[QLIB_IRQ_OFF_STATS_SIZE]; ///< Statistics per command type, in order of first use
+    U32                  otherMaxUs;                       ///< Longest window of the command types with no free entry
+} QLIB_IRQ_OFF_STATS_T;
+#endif // QLIB_IRQ_OFF_STATS_SIZE
+
+#ifdef QLIB_SPI_DESC_ENABLED
+/************************************************************************************************************
+ * Number of transaction descriptor sets kept in QLIB context. OP0 doesn't support QPI so the secure commands
+ * format alternates between QLIB_BUS_MODE_4_4_4 and QLIB_BUS_MODE_1_1_4 when QPI is used.
+************************************************************************************************************/
+#define QLIB_SPI_DESC_SETS 2
+
+/************************************************************************************************************
+ * SPI transaction descriptors used by the transaction manager hot paths
+************************************************************************************************************/
+typedef enum
+{
+    QLIB_SPI_DESC__OP0,          ///< Secure get SSR
+    QLIB_SPI_DESC__OP2,          ///< Secure read output buffer header
+    QLIB_SPI_DESC__READ_SR1,     ///< Standard read status register 1
+    QLIB_SPI_DESC__READ_SR2,     ///< Standard read status register 2
+    QLIB_SPI_DESC__WRITE_ENABLE, ///< Standard write enable
+    QLIB_SPI_DESC__NUM,
+} QLIB_SPI_DESC_ID_T;
+
+/************************************************************************************************************
+ * SPI transaction descriptors built for a single bus format
+************************************************************************************************************/
+typedef struct QLIB_SPI_DESC_SET_T
+{
+    QLIB_BUS_MODE_T secureCmdsFormat;         ///< Secure commands format the set was built for
+    QLIB_BUS_MODE_T stdFormat;                ///< Standard commands format the set was built for
+    BOOL            dtr;                      ///< DTR the set was built for
+    U8              op0;                      ///< OP0 opcode the set was built for
+    U8              op2;                      ///< OP2 opcode the set was built for
+    U8              valid;                    ///< The set is built
+    QLIB_SPI_DESC_T desc[QLIB_SPI_DESC__NUM]; ///< Descriptors, indexed by QLIB_SPI_DESC_ID_T
+} QLIB_SPI_DESC_SET_T;
+#endif // QLIB_SPI_DESC_ENABLED
+
 /************************************************************************************************************
  * QLIB context structure\n
  * [QLIB internal state](md_definitions.html#DEF_CONTEXT)
@@ -590,8 +780,65 @@ typedef struct
     QLIB_SECTION_STATE_T sectionsState[QLIB_NUM_OF_SECTIONS]; ///< section state and configuration
     QLIB_PRNG_STATE_T    prng;                                ///< PRNG state
     QLIB_RESET_STATUS_T resetStatus; ///< Last Reset status
+    volatile U8         tmInTransaction; ///< Transaction manager is executing a transaction
+#ifdef QLIB_SEC_READ_CACHE_SIZE
+    QLIB_SEC_READ_CACHE_T readCache; ///< Decrypted secure read pages cache
+#endif
+#ifdef QLIB_SEC_READ_AHEAD_ENABLED
+    QLIB_SEC_READ_AHEAD_T readAhead; ///< Sequential secure read-ahead state
+#endif
+#ifdef QLIB_SPI_ASYNC_ENABLED
+    U8 spiAsyncPending; ///< Asynchronous SPI transaction is in flight
+#endif
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+    QLIB_OP_TIME_MODEL_T opTimeModel; ///< Learned program, erase and signature completion times
+#endif
+#ifdef QLIB_IRQ_OFF_STATS_SIZE
+    QLIB_IRQ_OFF_STATS_T irqOffStats; ///< Longest interrupts masked window per command type
+    U32                  irqOffMaxUs; ///< Longest interrupts masked window of the current transaction
+#endif
+#ifdef QLIB_SPI_DESC_ENABLED
+    QLIB_SPI_DESC_SET_T spiDesc[QLIB_SPI_DESC_SETS]; ///< SPI transaction descriptors per bus format
+    U8                  spiDescLast;                 ///< Index of the last used descriptors set
+#endif
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+    U8 continuousReadEnabled; ///< Standard reads may use continuous read mode
+    U8 continuousReadCmd;     ///< Read instruction of the active continuous read mode, SPI_FLASH_CMD__NONE if not active
+#endif
+#ifdef QLIB_BUS_TUNE_ENABLED
+    QLIB_BUS_TUNE_T busTune;            ///< Last bus format auto-tuning decision
+    U8              qpiReadDummyCycles; ///< QPI read dummy cycles set in the flash, 0 for the default
+#endif
+#ifdef QLIB_STD_SFDP_ENABLED
+    QLIB_SFDP_T sfdp; ///< Device parameters read from SFDP at initialization
+#endif
+#ifdef QLIB_MAINT_SCHED_ENABLED
+    U32 mcMaintUs; ///< Longest measured monotonic counter maintenance iteration, in microseconds. 0 if not measured
+#endif
+#ifdef QLIB_NOTIF_SSR_MAX_AGE_US
+    U32  ssrTimeUs;   ///< Time the cached SSR was captured, in microseconds (see PLAT_GetTimeUs). Wraps after ~71 minutes
+    BOOL ssrCaptured; ///< TRUE once @ref ssrTimeUs holds a capture time, the initial value is not a capture
+#endif
 } QLIB_CONTEXT_T;
 
+/************************************************************************************************************
+ * Sensed device state, used by @ref QLIB_InitDeviceFromState to skip auto-sensing and state synchronization
+************************************************************************************************************/
+PACKED_START
+typedef struct QLIB_DEVICE_STATE_T
+{
+    U8  valid;                                   ///< TRUE if the device state was captured from an initialized device
+    U8  watchdogIsSecure;                        ///< Watchdog is secure indication
+    U8  watchdogSectionId;                       ///< Section key used for Secure Watchdog
+    U8  sectionsEnabled;                         ///< Bit per section, set if the section is enabled
+    U8  sectionsSizeTag[QLIB_NUM_OF_SECTIONS];   ///< Section size tag of each section
+    U32 addrSize;                                ///< Standard address size
+#ifdef QLIB_BUS_TUNE_ENABLED
+    U8 qpiReadDummyCycles; ///< QPI read dummy cycles set in the flash, 0 for the default
+#endif
+} PACKED QLIB_DEVICE_STATE_T;
+PACKED_END
+
 /************************************************************************************************************
  * Synchronization object
 ************************************************************************************************************/
@@ -601,6 +848,7 @@ typedef struct QLIB_SYNC_OBJ_T
     QLIB_INTERFACE_T busInterface;
     QLIB_WID_T       wid;
     QLIB_RESET_STATUS_T resetStatus;
+    QLIB_DEVICE_STATE_T deviceState;
 } PACKED QLIB_SYNC_OBJ_T;
 PACKED_END
 
@@ -615,6 +863,35 @@ typedef struct QLIB_NOTIFICATIONS_T
     U8 replaceDevice : 1; ///< Device replacement is needed since DMC is close to its max value
 } QLIB_NOTIFICATIONS_T;
 
+/************************************************************************************************************
+ * Read range descriptor, used by @ref QLIB_ReadV
+************************************************************************************************************/
+typedef struct QLIB_READ_RANGE_T
+{
+    U32           offset; ///< Section offset of the range
+    U8*           buf;    ///< Output buffer of the range
+    U32           size;   ///< Size of the range
+    QLIB_STATUS_T status; ///< Read status of the range, set by @ref QLIB_ReadV
+} QLIB_READ_RANGE_T;
+
+/************************************************************************************************************
+ * Write data fragment, used by @ref QLIB_WriteV
+************************************************************************************************************/
+typedef struct QLIB_WRITE_FRAGMENT_T
+{
+    const U8* buf;  ///< Fragment data
+    U32       size; ///< Fragment size
+} QLIB_WRITE_FRAGMENT_T;
+
+/************************************************************************************************************
+ * Erase range descriptor, used by @ref QLIB_EraseV
+************************************************************************************************************/
+typedef struct QLIB_ERASE_RANGE_T
+{
+    U32 offset; ///< Section offset of the range, aligned to FLASH_SECTOR_SIZE
+    U32 size;   ///< Size of the range, aligned to FLASH_SECTOR_SIZE
+} QLIB_ERASE_RANGE_T;
+
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                            DEPENDENT INCLUDES                                           */
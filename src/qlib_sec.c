@@ -41,6 +41,37 @@
 #define QLIB_SEC_TC_RESET_THRESHOLD 0xFFFFFFF0
 #endif
 
+/************************************************************************************************************
+ * Number of secure status polls @ref QLIB_SEC_ImportDeviceState waits for the secure module to become ready.
+ * User may choose to define a different value.
+************************************************************************************************************/
+#ifndef QLIB_SEC_IMPORT_STATE_MAX_POLLS
+#define QLIB_SEC_IMPORT_STATE_MAX_POLLS 1000
+#endif
+
+#ifdef QLIB_MAINT_SCHED_ENABLED
+/************************************************************************************************************
+ * Monotonic counter maintenance iteration time, in microseconds, assumed until it is measured.
+ * User may choose to define a different value.
+************************************************************************************************************/
+#ifndef QLIB_MAINT_SCHED_DEFAULT_US
+#define QLIB_MAINT_SCHED_DEFAULT_US 1000
+#endif
+#endif // QLIB_MAINT_SCHED_ENABLED
+
+#ifdef QLIB_SEC_READ_DIGEST_AUTH_ENABLED
+#ifndef QLIB_HASH_STREAM_ENABLED
+#error "QLIB_SEC_READ_DIGEST_AUTH_ENABLED requires the streaming hash, QLIB_HASH_STREAM_ENABLED must be defined"
+#endif
+/************************************************************************************************************
+ * Size of the chunks read and hashed by the digest authenticated read of a whole section.
+ * User may choose to define a different value, a multiple of the secure read page size.
+************************************************************************************************************/
+#ifndef QLIB_SEC_READ_DIGEST_AUTH_CHUNK
+#define QLIB_SEC_READ_DIGEST_AUTH_CHUNK 1024
+#endif
+#endif // QLIB_SEC_READ_DIGEST_AUTH_ENABLED
+
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                                  TYPES                                                  */
@@ -80,6 +111,8 @@ static QLIB_STATUS_T QLIB_SEC_GetStdAddrSize_L(QLIB_CONTEXT_T* qlibContext);
 static QLIB_STATUS_T QLIB_SEC_GetSectionsSize_L(QLIB_CONTEXT_T* qlibContext);
 static QLIB_STATUS_T QLIB_SEC_GetWatchdogConfig_L(QLIB_CONTEXT_T* qlibContext);
 static QLIB_STATUS_T QLIB_SEC_MarkSessionClose_L(QLIB_CONTEXT_T* qlibContext);
+static QLIB_STATUS_T QLIB_SEC_SyncAfterFlashReset_L(QLIB_CONTEXT_T* qlibContext, U32 maxPolls);
+static BOOL          QLIB_SEC_CachedSsrIsValid_L(QLIB_CONTEXT_T* qlibContext);
 static QLIB_STATUS_T QLIB_SEC_ConfigInitialSectionPolicy_L(QLIB_CONTEXT_T*      qlibContext,
                                                            U32                  sectionIndex,
                                                            const QLIB_POLICY_T* policy,
@@ -89,6 +122,21 @@ static QLIB_STATUS_T QLIB_SEC_GrantRevokePA_L(QLIB_CONTEXT_T* qlibContext, U32 s
 #ifndef QLIB_SEC_ONLY
 static QLIB_STATUS_T QLIB_SEC_VerifyAddressSizeConfig_L(QLIB_CONTEXT_T* qlibContext, const QLIB_STD_ADDR_SIZE_T* addrSizeConf);
 #endif
+#if !defined QLIB_SUPPORT_XIP && defined QLIB_SEC_READ_AHEAD_ENABLED
+static QLIB_STATUS_T QLIB_SEC_ReadSequential_L(QLIB_CONTEXT_T* qlibContext, U32* buf, U32 sectionID, U32 offset, U32 size);
+#endif
+static void QLIB_SEC_GatherFragments_L(const QLIB_WRITE_FRAGMENT_T** fragment, U32* fragmentOffset, U8* dst, U32 size);
+static BOOL QLIB_SEC_ReadVNextPage_L(const QLIB_READ_RANGE_T* ranges, U32 count, U32 fromOffset, U32* pageOffset);
+static void QLIB_SEC_ReadVCopyPage_L(QLIB_READ_RANGE_T* ranges, U32 count, U32 pageOffset, const U8* page);
+static void QLIB_SEC_ReadVSetStatus_L(QLIB_READ_RANGE_T* ranges, U32 count, U32 fromOffset, QLIB_STATUS_T status);
+#ifdef QLIB_SEC_READ_DIGEST_AUTH_ENABLED
+static BOOL          QLIB_SEC_ReadIsDigestArea_L(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U32 offset, U32 size);
+static QLIB_STATUS_T QLIB_SEC_ReadDigestAuth_L(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID, U32 size);
+#endif
+#ifdef QLIB_SEC_READ_CACHE_SIZE
+static BOOL          QLIB_SEC_ReadCacheIsUsable_L(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U32 size, BOOL auth);
+static QLIB_STATUS_T QLIB_SEC_ReadCached_L(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID, U32 offset, U32 size);
+#endif
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                          INTERFACE FUNCTIONS                                            */
@@ -106,6 +154,9 @@ QLIB_STATUS_T QLIB_SEC_InitLib(QLIB_CONTEXT_T* qlibContext)
     qlibContext->mcInSync            = FALSE;
     qlibContext->watchdogIsSecure    = FALSE;
     qlibContext->watchdogSectionId   = QLIB_NUM_OF_SECTIONS;
+#ifdef QLIB_SEC_READ_AHEAD_ENABLED
+    qlibContext->readAhead.sectionID = QLIB_NUM_OF_SECTIONS;
+#endif
 
     // Set the cached SSR busy bit in order to mark it as invalid
     SET_VAR_FIELD(qlibContext->ssr.asUint, QLIB_REG_SSR__BUSY, 1);
@@ -148,6 +199,83 @@ QLIB_STATUS_T QLIB_SEC_SyncState(QLIB_CONTEXT_T* qlibContext)
     return QLIB_STATUS__OK;
 }
 
+QLIB_STATUS_T QLIB_SEC_ExportDeviceState(QLIB_CONTEXT_T* qlibContext, QLIB_DEVICE_STATE_T* deviceState)
+{
+    U32 sectionID;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* The state is valid only if it was synchronized with the flash (address size is never 0 after sync)  */
+    /*-----------------------------------------------------------------------------------------------------*/
+    deviceState->valid =
+        ((qlibContext->busInterface.busMode != QLIB_BUS_MODE_INVALID) && (qlibContext->addrSize != 0)) ? TRUE : FALSE;
+
+    deviceState->watchdogIsSecure  = (U8)qlibContext->watchdogIsSecure;
+    deviceState->watchdogSectionId = (U8)qlibContext->watchdogSectionId;
+    deviceState->addrSize          = qlibContext->addrSize;
+    deviceState->sectionsEnabled   = 0;
+#ifdef QLIB_BUS_TUNE_ENABLED
+    deviceState->qpiReadDummyCycles = qlibContext->qpiReadDummyCycles;
+#endif
+    for (sectionID = 0; sectionID < QLIB_NUM_OF_SECTIONS; sectionID++)
+    {
+        deviceState->sectionsEnabled |= (U8)(qlibContext->sectionsState[sectionID].enabled << sectionID);
+        deviceState->sectionsSizeTag[sectionID] = qlibContext->sectionsState[sectionID].sizeTag;
+    }
+
+    return QLIB_STATUS__OK;
+}
+
+QLIB_STATUS_T QLIB_SEC_ImportDeviceState(QLIB_CONTEXT_T* qlibContext, const QLIB_DEVICE_STATE_T* deviceState)
+{
+    QLIB_WID_T wid;
+    U32        sectionID;
+
+    QLIB_ASSERT_RET(TRUE == deviceState->valid, QLIB_STATUS__INVALID_PARAMETER);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Validate the state is in range                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(LOG2(QLIB_MIN_STD_ADDR_SIZE) <= deviceState->addrSize &&
+                        LOG2(QLIB_MAX_STD_ADDR_SIZE) >= deviceState->addrSize,
+                    QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(QLIB_NUM_OF_SECTIONS > deviceState->watchdogSectionId, QLIB_STATUS__INVALID_PARAMETER);
+    for (sectionID = 0; sectionID < QLIB_NUM_OF_SECTIONS; sectionID++)
+    {
+        QLIB_ASSERT_RET(LOG2(QLIB_SEC_FLASH_SIZE / _64KB_) >= deviceState->sectionsSizeTag[sectionID],
+                        QLIB_STATUS__INVALID_PARAMETER);
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Validate the state belongs to the connected flash and the bus format is correct                     */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(QLIB_SEC_GetWID_L(qlibContext, wid));
+    QLIB_ASSERT_RET(0 == memcmp(wid, qlibContext->wid, sizeof(QLIB_WID_T)), QLIB_STATUS__SYSTEM_IN_INCORRECT_STATE);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Sync after reset, the reset status is refreshed from the flash. The wait is bounded, so a flash      */
+    /* which does not get ready fails the import instead of hanging                                        */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(QLIB_SEC_SyncAfterFlashReset_L(qlibContext, QLIB_SEC_IMPORT_STATE_MAX_POLLS));
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Restore the state                                                                                   */
+    /*-----------------------------------------------------------------------------------------------------*/
+    qlibContext->watchdogIsSecure  = INT_TO_BOOLEAN(deviceState->watchdogIsSecure);
+    qlibContext->watchdogSectionId = deviceState->watchdogSectionId;
+    qlibContext->addrSize          = deviceState->addrSize;
+#ifdef QLIB_BUS_TUNE_ENABLED
+    qlibContext->qpiReadDummyCycles = deviceState->qpiReadDummyCycles;
+#endif
+    for (sectionID = 0; sectionID < QLIB_NUM_OF_SECTIONS; sectionID++)
+    {
+        qlibContext->sectionsState[sectionID].enabled      = (deviceState->sectionsEnabled >> sectionID) & 1u;
+        qlibContext->sectionsState[sectionID].sizeTag      = deviceState->sectionsSizeTag[sectionID];
+        qlibContext->sectionsState[sectionID].plainEnabled = 0;
+    }
+
+    return QLIB_STATUS__OK;
+}
+
 QLIB_STATUS_T QLIB_SEC_Format(QLIB_CONTEXT_T* qlibContext, const KEY_T deviceMasterKey, BOOL eraseDataOnly)
 {
     QLIB_STATUS_T ret = QLIB_STATUS__COMMAND_FAIL;
@@ -158,6 +286,14 @@ QLIB_STATUS_T QLIB_SEC_Format(QLIB_CONTEXT_T* qlibContext, const KEY_T deviceMas
     QLIB_ASSERT_RET(qlibContext->isPoweredDown == FALSE, QLIB_STATUS__COMMAND_IGNORED);
     QLIB_ASSERT_RET(qlibContext->isSuspended == FALSE, QLIB_STATUS__COMMAND_IGNORED);
 
+#ifdef QLIB_SEC_READ_CACHE_SIZE
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Sections configuration is lost, caching must be re-enabled by the user                              */
+    /*-----------------------------------------------------------------------------------------------------*/
+    qlibContext->readCache.sectionsEnabled = 0;
+    QLIB_SEC_ReadCacheInvalidate(qlibContext);
+#endif // QLIB_SEC_READ_CACHE_SIZE
+
     if (NULL == deviceMasterKey)
     {
         /*-------------------------------------------------------------------------------------------------*/
@@ -239,9 +375,9 @@ QLIB_STATUS_T QLIB_SEC_GetNotifications(QLIB_CONTEXT_T* qlibContext, QLIB_NOTIFI
     QLIB_ASSERT_RET(qlibContext->isPoweredDown == FALSE, QLIB_STATUS__COMMAND_IGNORED);
 
     /*-----------------------------------------------------------------------------------------------------*/
-    /* SSR is not valid while busy, if busy, update the cached SSR                                         */
+    /* The cached SSR is captured by every secure command, update it only if it is not valid               */
     /*-----------------------------------------------------------------------------------------------------*/
-    if (1 == READ_VAR_FIELD(qlibContext->ssr.asUint, QLIB_REG_SSR__BUSY))
+    if (FALSE == QLIB_SEC_CachedSsrIsValid_L(qlibContext))
     {
         QLIB_STATUS_RET_CHECK(QLIB_SEC__get_SSR(qlibContext, &qlibContext->ssr, SSR_MASK__ALL_ERRORS));
     }
@@ -286,6 +422,49 @@ QLIB_STATUS_T QLIB_SEC_PerformMCMaint(QLIB_CONTEXT_T* qlibContext)
     return QLIB_STATUS__OK;
 }
 
+#ifdef QLIB_MAINT_SCHED_ENABLED
+QLIB_STATUS_T QLIB_SEC_PerformMCMaintIdle(QLIB_CONTEXT_T* qlibContext, U32 idleUs, BOOL* pending)
+{
+    U32 startUs    = PLAT_GetTimeUs();
+    U32 iterStart  = 0;
+    U32 iterUs     = 0;
+    U32 estimateUs = (0 != qlibContext->mcMaintUs) ? qlibContext->mcMaintUs : QLIB_MAINT_SCHED_DEFAULT_US;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Secure command is ignored if power is down or suspended                                             */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(qlibContext->isPoweredDown == FALSE, QLIB_STATUS__COMMAND_IGNORED);
+    QLIB_ASSERT_RET(qlibContext->isSuspended == FALSE, QLIB_STATUS__COMMAND_IGNORED);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* The SSR received by the last secure command tells if maintenance is needed. It is read only if it   */
+    /* is not valid, same as in QLIB_SEC_GetNotifications                                                  */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (FALSE == QLIB_SEC_CachedSsrIsValid_L(qlibContext))
+    {
+        QLIB_STATUS_RET_CHECK(QLIB_SEC__get_SSR(qlibContext, &qlibContext->ssr, SSR_MASK__ALL_ERRORS));
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Perform maintenance iterations while the next iteration fits in the idle window                     */
+    /*-----------------------------------------------------------------------------------------------------*/
+    while ((0 != READ_VAR_FIELD(qlibContext->ssr.asUint, QLIB_REG_SSR__MC_MAINT)) &&
+           (((PLAT_GetTimeUs() - startUs) + estimateUs) <= idleUs))
+    {
+        iterStart = PLAT_GetTimeUs();
+        QLIB_STATUS_RET_CHECK(QLIB_CMD_PROC__MC_MAINT(qlibContext));
+        iterUs = PLAT_GetTimeUs() - iterStart;
+
+        qlibContext->mcMaintUs = MAX(qlibContext->mcMaintUs, iterUs);
+        estimateUs             = qlibContext->mcMaintUs;
+    }
+
+    *pending = (0 != READ_VAR_FIELD(qlibContext->ssr.asUint, QLIB_REG_SSR__MC_MAINT)) ? TRUE : FALSE;
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_MAINT_SCHED_ENABLED
+
 QLIB_STATUS_T QLIB_SEC_ConfigDevice(QLIB_CONTEXT_T*                   qlibContext,
                                     const KEY_T                       deviceMasterKey,
                                     const KEY_T                       deviceSecretKey,
@@ -306,6 +485,13 @@ QLIB_STATUS_T QLIB_SEC_ConfigDevice(QLIB_CONTEXT_T*                   qlibContex
     QLIB_ASSERT_RET(qlibContext->isPoweredDown == FALSE, QLIB_STATUS__COMMAND_IGNORED);
     QLIB_ASSERT_RET(qlibContext->isSuspended == FALSE, QLIB_STATUS__COMMAND_IGNORED);
 
+#ifdef QLIB_SEC_READ_CACHE_SIZE
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Sections configuration is replaced, caching must be re-enabled by the user                          */
+    /*-----------------------------------------------------------------------------------------------------*/
+    qlibContext->readCache.sectionsEnabled = 0;
+    QLIB_SEC_ReadCacheInvalidate(qlibContext);
+#endif // QLIB_SEC_READ_CACHE_SIZE
 
     /*-----------------------------------------------------------------------------------------------------*/
     /* Write all keys                                                                                      */
@@ -678,6 +864,13 @@ QLIB_STATUS_T QLIB_SEC_ConfigSection(QLIB_CONTEXT_T*      qlibContext,
 
     qlibContext->sectionsState[sectionID].plainEnabled = (needInitPA == TRUE ? 1 : 0);
 
+#ifdef QLIB_SEC_READ_CACHE_SIZE
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Section policy may have changed, caching must be re-enabled by the user                             */
+    /*-----------------------------------------------------------------------------------------------------*/
+    qlibContext->readCache.sectionsEnabled &= (U8)(~(1u << sectionID));
+#endif // QLIB_SEC_READ_CACHE_SIZE
+
     /*-----------------------------------------------------------------------------------------------------*/
     /* Mark session as closed as SET_CSR/SET_SCR_SWAP closes the session in flash                          */
     /*-----------------------------------------------------------------------------------------------------*/
@@ -822,6 +1015,16 @@ QLIB_STATUS_T QLIB_SEC_Read(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID,
                         QLIB_KEY_MNGR_IS_SECTION_RESTRICTED_ACCESS(qlibContext, sectionID),
                     QLIB_STATUS__DEVICE_PRIVILEGE_ERR);
 
+#ifdef QLIB_SEC_READ_DIGEST_AUTH_ENABLED
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Authenticated read of the whole section is authenticated by a single section digest                 */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if ((TRUE == auth) && (TRUE == QLIB_SEC_ReadIsDigestArea_L(qlibContext, sectionID, offset, size)))
+    {
+        return QLIB_SEC_ReadDigestAuth_L(qlibContext, buf, sectionID, size);
+    }
+#endif // QLIB_SEC_READ_DIGEST_AUTH_ENABLED
+
     /*-----------------------------------------------------------------------------------------------------*/
     /* Mark multi-transaction started                                                                      */
     /*-----------------------------------------------------------------------------------------------------*/
@@ -832,6 +1035,16 @@ QLIB_STATUS_T QLIB_SEC_Read(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID,
 #endif //QLIB_SPI_OPTIMIZATION_ENABLED
     offsetInPage = (offset % QLIB_SEC_READ_PAGE_SIZE_BYTE);
 
+#ifdef QLIB_SEC_READ_CACHE_SIZE
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Small non-authenticated reads of cache enabled sections are served from the read cache              */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (TRUE == QLIB_SEC_ReadCacheIsUsable_L(qlibContext, sectionID, offsetInPage + size, auth))
+    {
+        ret = QLIB_SEC_ReadCached_L(qlibContext, buf, sectionID, offset, size);
+    }
+    else
+#endif // QLIB_SEC_READ_CACHE_SIZE
     /*-----------------------------------------------------------------------------------------------------*/
     /* Check if we can use aligned access optimization while flash is busy                                 */
     /*-----------------------------------------------------------------------------------------------------*/
@@ -848,7 +1061,11 @@ QLIB_STATUS_T QLIB_SEC_Read(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID,
         }
         else
         {
+#ifdef QLIB_SEC_READ_AHEAD_ENABLED
+            ret = QLIB_SEC_ReadSequential_L(qlibContext, (U32*)(UPTR)buf, sectionID, offset, size);
+#else
             ret = QLIB_CMD_PROC__SRD_Multi(qlibContext, offset, (U32*)(UPTR)buf, size);
+#endif // QLIB_SEC_READ_AHEAD_ENABLED
         }
     }
     else
@@ -899,6 +1116,117 @@ finish:
     return ret;
 }
 
+/************************************************************************************************************
+ * @brief       This function performs secure read of multiple ranges from one section.
+ *              Each page needed by the ranges is read once and copied to all the ranges it covers.
+ *              Consecutive pages are read in a single pipeline.
+ *
+ * @param       qlibContext   QLIB state object
+ * @param       ranges        Array of read ranges, only ranges with QLIB_STATUS__OK status are read
+ * @param       count         Number of ranges
+ * @param       sectionID     Section index
+ * @param       auth          if TRUE, read operation will be authenticated
+ *
+ * @return      QLIB_STATUS__OK on success or QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SEC_ReadV(QLIB_CONTEXT_T* qlibContext, QLIB_READ_RANGE_T* ranges, U32 count, U32 sectionID, BOOL auth)
+{
+    U32              page[QLIB_SEC_READ_PAGE_SIZE_BYTE / sizeof(U32)];
+    U32              pageOffset = 0;
+    U32              nextOffset = 0;
+    BOOL             readPage   = FALSE;
+    QLIB_READ_FUNC_T readFunc   = (TRUE == auth) ? QLIB_CMD_PROC__SARD : QLIB_CMD_PROC__SRD;
+    QLIB_STATUS_T    ret        = QLIB_STATUS__OK;
+#ifndef QLIB_SUPPORT_XIP
+    BOOL started   = FALSE;
+    BOOL pipelined = FALSE;
+#endif
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Secure command is ignored if power is down or suspended                                             */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_WITH_ERROR_GOTO(qlibContext->isPoweredDown == FALSE, QLIB_STATUS__COMMAND_IGNORED, ret, error);
+    QLIB_ASSERT_WITH_ERROR_GOTO(qlibContext->isSuspended == FALSE, QLIB_STATUS__COMMAND_IGNORED, ret, error);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_WITH_ERROR_GOTO(TRUE == QLIB_KEY_MNGR__SESSION_IS_OPEN(qlibContext), QLIB_STATUS__DEVICE_SESSION_ERR, ret, error);
+    QLIB_ASSERT_WITH_ERROR_GOTO(QLIB_KEYMNGR_IS_SECTION_FULL_ACCESS(qlibContext, sectionID) ||
+                                    QLIB_KEY_MNGR_IS_SECTION_RESTRICTED_ACCESS(qlibContext, sectionID),
+                                QLIB_STATUS__DEVICE_PRIVILEGE_ERR,
+                                ret,
+                                error);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Mark multi-transaction started                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    qlibContext->multiTransactionCmd = TRUE;
+#ifdef QLIB_SPI_OPTIMIZATION_ENABLED
+    PLAT_SPI_MultiTransactionStart();
+#endif //QLIB_SPI_OPTIMIZATION_ENABLED
+
+    readPage = QLIB_SEC_ReadVNextPage_L(ranges, count, 0, &pageOffset);
+
+    while (TRUE == readPage)
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Find the next page needed by the ranges                                                         */
+        /*-------------------------------------------------------------------------------------------------*/
+        readPage = QLIB_SEC_ReadVNextPage_L(ranges, count, pageOffset + QLIB_SEC_READ_PAGE_SIZE_BYTE, &nextOffset);
+
+#ifndef QLIB_SUPPORT_XIP
+        if ((FALSE == auth) && (qlibContext->busInterface.busMode != QLIB_BUS_MODE_4_4_4))
+        {
+            /*---------------------------------------------------------------------------------------------*/
+            /* Start the read of the next page while this page is read, if the next page is consecutive    */
+            /*---------------------------------------------------------------------------------------------*/
+            pipelined = ((TRUE == readPage) && ((pageOffset + QLIB_SEC_READ_PAGE_SIZE_BYTE) == nextOffset)) ? TRUE : FALSE;
+            QLIB_STATUS_RET_CHECK_GOTO(QLIB_CMD_PROC__SRD_Multi_ReadAhead(qlibContext,
+                                                                          pageOffset,
+                                                                          page,
+                                                                          QLIB_SEC_READ_PAGE_SIZE_BYTE,
+                                                                          started,
+                                                                          pipelined),
+                                       ret,
+                                       finish);
+            started = pipelined;
+        }
+        else
+#endif // QLIB_SUPPORT_XIP
+        {
+            QLIB_STATUS_RET_CHECK_GOTO(readFunc(qlibContext, pageOffset, page), ret, finish);
+        }
+
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Copy the page to all the ranges it covers                                                       */
+        /*-------------------------------------------------------------------------------------------------*/
+        QLIB_SEC_ReadVCopyPage_L(ranges, count, pageOffset, (U8*)page);
+        pageOffset = nextOffset;
+    }
+
+finish:
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Mark multi-transaction ended                                                                        */
+    /*-----------------------------------------------------------------------------------------------------*/
+    qlibContext->multiTransactionCmd = FALSE;
+
+#ifdef QLIB_SPI_OPTIMIZATION_ENABLED
+    PLAT_SPI_MultiTransactionStop();
+#endif //QLIB_SPI_OPTIMIZATION_ENABLED
+
+error:
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Ranges which were not read completely get the error status                                          */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (QLIB_STATUS__OK != ret)
+    {
+        QLIB_SEC_ReadVSetStatus_L(ranges, count, pageOffset, ret);
+    }
+
+    return ret;
+}
+
 /************************************************************************************************************
  * @brief       This function perform secure write data to the flash.
  *
@@ -912,8 +1240,42 @@ finish:
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_SEC_Write(QLIB_CONTEXT_T* qlibContext, const U8* buf, U32 sectionID, U32 offset, U32 size)
 {
-    U32           iterSize     = 0;
-    U32           offsetInPage = 0;
+    QLIB_WRITE_FRAGMENT_T fragment;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != buf, QLIB_STATUS__INVALID_PARAMETER);
+
+    fragment.buf  = buf;
+    fragment.size = size;
+
+    return QLIB_SEC_WriteV(qlibContext, &fragment, 1, sectionID, offset, size);
+}
+
+/************************************************************************************************************
+ * @brief       This function perform secure write of data gathered from multiple fragments to the flash.
+ *              Each page is built directly from the fragments.
+ *
+ * @param       qlibContext   QLIB state object
+ * @param       fragments     Array of data fragments, written one after the other
+ * @param       count         Number of fragments
+ * @param       sectionID     Section index
+ * @param       offset        Section offset
+ * @param       size          Data size, the total size of the fragments
+ *
+ * @return      QLIB_STATUS__OK on success or QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SEC_WriteV(QLIB_CONTEXT_T*              qlibContext,
+                              const QLIB_WRITE_FRAGMENT_T* fragments,
+                              U32                          count,
+                              U32                          sectionID,
+                              U32                          offset,
+                              U32                          size)
+{
+    U32           iterSize       = 0;
+    U32           offsetInPage   = 0;
+    U32           fragmentOffset = 0;
     U32           pageBuf[QLIB_SEC_WRITE_PAGE_SIZE_BYTE / sizeof(U32)];
     QLIB_STATUS_T ret = QLIB_STATUS__OK;
 
@@ -926,10 +1288,13 @@ QLIB_STATUS_T QLIB_SEC_Write(QLIB_CONTEXT_T* qlibContext, const U8* buf, U32 sec
     /*-----------------------------------------------------------------------------------------------------*/
     /* Error checking                                                                                      */
     /*-----------------------------------------------------------------------------------------------------*/
-    QLIB_ASSERT_RET(NULL != buf, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != fragments, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 < count, QLIB_STATUS__INVALID_PARAMETER);
     QLIB_ASSERT_RET(TRUE == QLIB_KEY_MNGR__SESSION_IS_OPEN(qlibContext), QLIB_STATUS__DEVICE_SESSION_ERR);
     QLIB_ASSERT_RET(QLIB_KEYMNGR_IS_SECTION_FULL_ACCESS(qlibContext, sectionID), QLIB_STATUS__DEVICE_PRIVILEGE_ERR);
 
+    QLIB_SEC_READ_CACHE_INVALIDATE(qlibContext);
+
     /*-----------------------------------------------------------------------------------------------------*/
     /* Mark multi-transaction command                                                                      */
     /*-----------------------------------------------------------------------------------------------------*/
@@ -953,7 +1318,7 @@ QLIB_STATUS_T QLIB_SEC_Write(QLIB_CONTEXT_T* qlibContext, const U8* buf, U32 sec
             memset(pageBuf, 0xFF, QLIB_SEC_WRITE_PAGE_SIZE_BYTE);
         }
 
-        memcpy((U8*)pageBuf + offsetInPage, buf, iterSize);
+        QLIB_SEC_GatherFragments_L(&fragments, &fragmentOffset, (U8*)pageBuf + offsetInPage, iterSize);
 
         /*-------------------------------------------------------------------------------------------------*/
         /* One page write                                                                                  */
@@ -965,7 +1330,6 @@ QLIB_STATUS_T QLIB_SEC_Write(QLIB_CONTEXT_T* qlibContext, const U8* buf, U32 sec
         /* Prepare pointers for next iteration                                                             */
         /*-------------------------------------------------------------------------------------------------*/
         size         = size - iterSize;
-        buf          = buf + iterSize;
         offset       = offset + QLIB_SEC_WRITE_PAGE_SIZE_BYTE;
         offsetInPage = 0;
         iterSize     = MIN(size, QLIB_SEC_WRITE_PAGE_SIZE_BYTE);
@@ -1004,26 +1368,14 @@ QLIB_STATUS_T QLIB_SEC_Erase(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U32 off
     QLIB_ASSERT_RET(TRUE == QLIB_KEY_MNGR__SESSION_IS_OPEN(qlibContext), QLIB_STATUS__DEVICE_SESSION_ERR);
     QLIB_ASSERT_RET(QLIB_KEYMNGR_IS_SECTION_FULL_ACCESS(qlibContext, sectionID), QLIB_STATUS__DEVICE_PRIVILEGE_ERR);
 
+    QLIB_SEC_READ_CACHE_INVALIDATE(qlibContext);
+
     /*-----------------------------------------------------------------------------------------------------*/
     /* Start erasing with optimal command                                                                  */
     /*-----------------------------------------------------------------------------------------------------*/
     while (0 < size)
     {
-        if (_64KB_ <= size && 0 == (offset % _64KB_))
-        {
-            eraseSize = _64KB_;
-            eraseType = QLIB_ERASE_BLOCK_64K;
-        }
-        else if (_32KB_ <= size && 0 == (offset % _32KB_))
-        {
-            eraseSize = _32KB_;
-            eraseType = QLIB_ERASE_BLOCK_32K;
-        }
-        else
-        {
-            eraseSize = _4KB_;
-            eraseType = QLIB_ERASE_SECTOR_4K;
-        }
+        eraseType = QLIB_STD_GetEraseType(qlibContext, offset, size, &eraseSize);
 
         /*-------------------------------------------------------------------------------------------------*/
         /* Perform the erase                                                                               */
@@ -1048,6 +1400,8 @@ QLIB_STATUS_T QLIB_SEC_EraseSection(QLIB_CONTEXT_T* qlibContext, U32 sectionID,
     QLIB_ASSERT_RET(qlibContext->isPoweredDown == FALSE, QLIB_STATUS__COMMAND_IGNORED);
     QLIB_ASSERT_RET(qlibContext->isSuspended == FALSE, QLIB_STATUS__COMMAND_IGNORED);
 
+    QLIB_SEC_READ_CACHE_INVALIDATE(qlibContext);
+
     /*-----------------------------------------------------------------------------------------------------*/
     /* Check if plain or secure section erase                                                              */
     /*-----------------------------------------------------------------------------------------------------*/
@@ -1198,6 +1552,44 @@ QLIB_STATUS_T QLIB_SEC_CheckIntegrity(QLIB_CONTEXT_T* qlibContext, U32 sectionID
     return QLIB_STATUS__OK;
 }
 
+QLIB_STATUS_T QLIB_SEC_CalcSectionDigest(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U64* digest)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Secure command is ignored if power is down or suspended                                             */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(qlibContext->isPoweredDown == FALSE, QLIB_STATUS__COMMAND_IGNORED);
+    QLIB_ASSERT_RET(qlibContext->isSuspended == FALSE, QLIB_STATUS__COMMAND_IGNORED);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(QLIB_NUM_OF_SECTIONS > sectionID, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(TRUE == QLIB_KEY_MNGR__SESSION_IS_OPEN(qlibContext), QLIB_STATUS__DEVICE_SESSION_ERR);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* The digest is calculated by the device over the current section content                            */
+    /*-----------------------------------------------------------------------------------------------------*/
+    *digest = 0;
+    QLIB_STATUS_RET_CHECK(
+        QLIB_CMD_PROC__CALC_SIG(qlibContext, QLIB_SIGNED_DATA_TYPE_SECTION_DIGEST, sectionID, (U32*)digest, sizeof(*digest), NULL));
+
+    return QLIB_STATUS__OK;
+}
+
+QLIB_STATUS_T QLIB_SEC_VerifySectionDigest(QLIB_CONTEXT_T* qlibContext, U32 sectionID, const _256BIT hash)
+{
+    U64 digest = 0;
+
+    QLIB_STATUS_RET_CHECK(QLIB_SEC_CalcSectionDigest(qlibContext, sectionID, &digest));
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* The section digest is the last 64 bits of the hash of the section digest area                       */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET((((U32*)&digest)[0] == hash[6]) && (((U32*)&digest)[1] == hash[7]), QLIB_STATUS__SECURITY_ERR);
+
+    return QLIB_STATUS__OK;
+}
+
 QLIB_STATUS_T QLIB_SEC_CalcCDI(QLIB_CONTEXT_T* qlibContext, _256BIT nextCdi, _256BIT prevCdi, U32 sectionId)
 {
     _512BIT       hashData;
@@ -1535,39 +1927,7 @@ QLIB_STATUS_T QLIB_SEC_SetInterface(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_FORMAT
 
 QLIB_STATUS_T QLIB_SEC_SyncAfterFlashReset(QLIB_CONTEXT_T* qlibContext)
 {
-    QLIB_STATUS_T  status = QLIB_STATUS__TEST_FAIL;
-    QLIB_REG_SSR_T ssr;
-    U32            sectionID;
-
-    /*-----------------------------------------------------------------------------------------------------*/
-    /* refresh the out-dated information                                                                   */
-    /*-----------------------------------------------------------------------------------------------------*/
-    QLIB_STATUS_RET_CHECK(QLIB_SEC_MarkSessionClose_L(qlibContext));
-
-    /*-----------------------------------------------------------------------------------------------------*/
-    /* Plain sessions got closed after reset                                                               */
-    /*-----------------------------------------------------------------------------------------------------*/
-    for (sectionID = 0; sectionID < QLIB_NUM_OF_SECTIONS; sectionID++)
-    {
-        qlibContext->sectionsState[sectionID].plainEnabled = 0;
-    }
-
-    /*-----------------------------------------------------------------------------------------------------*/
-    /* Wait while secure module is not-ready                                                               */
-    /*-----------------------------------------------------------------------------------------------------*/
-    do
-    {
-        status = QLIB_SEC__get_SSR(qlibContext, &ssr, SSR_MASK__ALL_ERRORS);
-    } while (QLIB_STATUS__OK != status || READ_VAR_FIELD(ssr.asUint, QLIB_REG_SSR__BUSY));
-
-    /*-----------------------------------------------------------------------------------------------------*/
-    /* Cache reset status                                                                                  */
-    /*-----------------------------------------------------------------------------------------------------*/
-    qlibContext->resetStatus.powerOnReset      = READ_VAR_FIELD(ssr.asUint, QLIB_REG_SSR__POR);
-    qlibContext->resetStatus.fallbackRemapping = READ_VAR_FIELD(ssr.asUint, QLIB_REG_SSR__FB_REMAP);
-    qlibContext->resetStatus.watchdogReset     = READ_VAR_FIELD(ssr.asUint, QLIB_REG_SSR__AWDT_EXP);
-
-    return QLIB_STATUS__OK;
+    return QLIB_SEC_SyncAfterFlashReset_L(qlibContext, 0);
 }
 
 QLIB_STATUS_T QLIB_SEC_EnablePlainAccess(QLIB_CONTEXT_T* qlibContext, U32 sectionID)
@@ -1619,6 +1979,44 @@ QLIB_STATUS_T QLIB_SEC_EnablePlainAccess(QLIB_CONTEXT_T* qlibContext, U32 sectio
     return QLIB_STATUS__OK;
 }
 
+#ifdef QLIB_SEC_READ_CACHE_SIZE
+QLIB_STATUS_T QLIB_SEC_ReadCacheEnable(QLIB_CONTEXT_T* qlibContext, U32 sectionID, BOOL enable)
+{
+    QLIB_POLICY_T policy;
+
+    if (TRUE == enable)
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Plain write access may change the section content behind QLIB, so cached data could be stale    */
+        /*-------------------------------------------------------------------------------------------------*/
+        QLIB_STATUS_RET_CHECK(QLIB_SEC_GetSectionConfiguration(qlibContext, sectionID, NULL, NULL, &policy, NULL, NULL, NULL));
+        QLIB_ASSERT_RET(0 == policy.plainAccessWriteEnable, QLIB_STATUS__NOT_SUPPORTED);
+
+        qlibContext->readCache.sectionsEnabled |= (U8)(1u << sectionID);
+    }
+    else
+    {
+        qlibContext->readCache.sectionsEnabled &= (U8)(~(1u << sectionID));
+        QLIB_SEC_ReadCacheInvalidate(qlibContext);
+    }
+
+    return QLIB_STATUS__OK;
+}
+
+void QLIB_SEC_ReadCacheInvalidate(QLIB_CONTEXT_T* qlibContext)
+{
+    U32 i;
+
+    for (i = 0; i < QLIB_SEC_READ_CACHE_SIZE; i++)
+    {
+        if (0 != qlibContext->readCache.entries[i].valid)
+        {
+            memset(&qlibContext->readCache.entries[i], 0, sizeof(QLIB_SEC_READ_CACHE_ENTRY_T));
+        }
+    }
+}
+#endif // QLIB_SEC_READ_CACHE_SIZE
+
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                            LOCAL FUNCTIONS                                              */
@@ -2095,10 +2493,96 @@ static QLIB_STATUS_T QLIB_SEC_MarkSessionClose_L(QLIB_CONTEXT_T* qlibContext)
     memset(QLIB_HASH_BUF_GET__KEY(qlibContext->keyMngr.cmdContexArr[1].hashBuf), 0xFF, sizeof(_128BIT));
     qlibContext->keyMngr.kid = QLIB_KID__INVALID;
     qlibContext->mcInSync    = FALSE;
+    QLIB_SEC_READ_CACHE_INVALIDATE(qlibContext);
+
+    return QLIB_STATUS__OK;
+}
+
+/************************************************************************************************************
+ * @brief       This function refreshes the out-dated information in the lib context after reset, and waits
+ *              while the secure module is not-ready
+ *
+ * @param       qlibContext   QLIB state object
+ * @param       maxPolls      Maximal number of secure status polls, 0 to wait until the secure module is ready
+ *
+ * @return
+ * QLIB_STATUS__OK on success\n
+ * QLIB_STATUS__DEVICE_BUSY if the secure module is still busy after @p maxPolls polls\n
+ * QLIB_STATUS__SYSTEM_IN_INCORRECT_STATE if the secure status still reports an error after @p maxPolls polls\n
+ * QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_SEC_SyncAfterFlashReset_L(QLIB_CONTEXT_T* qlibContext, U32 maxPolls)
+{
+    QLIB_STATUS_T  status = QLIB_STATUS__TEST_FAIL;
+    QLIB_REG_SSR_T ssr;
+    U32            sectionID;
+    U32            polls = 0;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* refresh the out-dated information                                                                   */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(QLIB_SEC_MarkSessionClose_L(qlibContext));
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Plain sessions got closed after reset                                                               */
+    /*-----------------------------------------------------------------------------------------------------*/
+    for (sectionID = 0; sectionID < QLIB_NUM_OF_SECTIONS; sectionID++)
+    {
+        qlibContext->sectionsState[sectionID].plainEnabled = 0;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Wait while secure module is not-ready                                                               */
+    /*-----------------------------------------------------------------------------------------------------*/
+    do
+    {
+        if (0 != maxPolls && maxPolls == polls++)
+        {
+            return (QLIB_STATUS__OK == status) ? QLIB_STATUS__DEVICE_BUSY : QLIB_STATUS__SYSTEM_IN_INCORRECT_STATE;
+        }
+        status = QLIB_SEC__get_SSR(qlibContext, &ssr, SSR_MASK__ALL_ERRORS);
+    } while (QLIB_STATUS__OK != status || READ_VAR_FIELD(ssr.asUint, QLIB_REG_SSR__BUSY));
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Cache reset status                                                                                  */
+    /*-----------------------------------------------------------------------------------------------------*/
+    qlibContext->resetStatus.powerOnReset      = READ_VAR_FIELD(ssr.asUint, QLIB_REG_SSR__POR);
+    qlibContext->resetStatus.fallbackRemapping = READ_VAR_FIELD(ssr.asUint, QLIB_REG_SSR__FB_REMAP);
+    qlibContext->resetStatus.watchdogReset     = READ_VAR_FIELD(ssr.asUint, QLIB_REG_SSR__AWDT_EXP);
 
     return QLIB_STATUS__OK;
 }
 
+/************************************************************************************************************
+ * @brief       This function checks if the SSR cached in QLIB context can be used instead of reading the SSR
+ *
+ * The cached SSR is not valid while busy. If QLIB_NOTIF_SSR_MAX_AGE_US is defined, it is also not valid before
+ * its first capture or once it is older than QLIB_NOTIF_SSR_MAX_AGE_US. The age is computed by unsigned
+ * subtraction of U32 microsecond stamps, so it is correct across a wrap of PLAT_GetTimeUs, as long as the cached
+ * SSR is refreshed within the wrap period (~71 minutes).
+ *
+ * @param       qlibContext   QLIB state object
+ *
+ * @return      TRUE if the cached SSR is valid, FALSE otherwise
+************************************************************************************************************/
+static BOOL QLIB_SEC_CachedSsrIsValid_L(QLIB_CONTEXT_T* qlibContext)
+{
+    if (1 == READ_VAR_FIELD(qlibContext->ssr.asUint, QLIB_REG_SSR__BUSY))
+    {
+        return FALSE;
+    }
+
+#ifdef QLIB_NOTIF_SSR_MAX_AGE_US
+    if ((FALSE == qlibContext->ssrCaptured) ||
+        ((U32)(PLAT_GetTimeUs() - qlibContext->ssrTimeUs) > (U32)(QLIB_NOTIF_SSR_MAX_AGE_US)))
+    {
+        return FALSE;
+    }
+#endif
+
+    return TRUE;
+}
+
 /************************************************************************************************************
  * @brief This function closes the session
  *
@@ -2382,3 +2866,351 @@ static QLIB_STATUS_T QLIB_SEC_VerifyAddressSizeConfig_L(QLIB_CONTEXT_T* qlibCont
     return QLIB_STATUS__OK;
 }
 #endif
+
+#ifdef QLIB_SEC_READ_CACHE_SIZE
+/************************************************************************************************************
+ * @brief       This function checks if a secure read can be served by the read cache
+ *
+ * @param       qlibContext     QLIB state object
+ * @param       sectionID       Section index
+ * @param       size            Read size including the offset of the first page
+ * @param       auth            TRUE if the read is authenticated
+ *
+ * @return      TRUE if the read cache should be used, FALSE otherwise
+************************************************************************************************************/
+static BOOL QLIB_SEC_ReadCacheIsUsable_L(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U32 size, BOOL auth)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Authenticated reads always read the flash. Reads larger than the cache would only thrash it         */
+    /*-----------------------------------------------------------------------------------------------------*/
+    return ((FALSE == auth) && (0 != (qlibContext->readCache.sectionsEnabled & (1u << sectionID))) &&
+            (size <= (QLIB_SEC_READ_CACHE_SIZE * QLIB_SEC_READ_PAGE_SIZE_BYTE)))
+               ? TRUE
+               : FALSE;
+}
+
+/************************************************************************************************************
+ * @brief       This function performs a secure read through the read cache.
+ *              Missing pages are read from the flash into the least recently used cache entries.
+ *
+ * @param       qlibContext     QLIB state object
+ * @param       buf             Pointer to output buffer
+ * @param       sectionID       Section index
+ * @param       offset          Section offset
+ * @param       size            Size of read data
+ *
+ * @return      QLIB_STATUS__OK on success or QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_SEC_ReadCached_L(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID, U32 offset, U32 size)
+{
+    QLIB_SEC_READ_CACHE_T*       cache        = &qlibContext->readCache;
+    QLIB_SEC_READ_CACHE_ENTRY_T* entry        = NULL;
+    U32                          offsetInPage = (offset % QLIB_SEC_READ_PAGE_SIZE_BYTE);
+    U32                          iterSize     = MIN(size, (QLIB_SEC_READ_PAGE_SIZE_BYTE - offsetInPage));
+    U32                          i;
+
+    offset = offset - offsetInPage;
+
+    while (0 != size)
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Look for the page, keep the least recently used entry as replacement candidate                  */
+        /*-------------------------------------------------------------------------------------------------*/
+        entry = &cache->entries[0];
+        for (i = 0; i < QLIB_SEC_READ_CACHE_SIZE; i++)
+        {
+            if ((0 != cache->entries[i].valid) && (sectionID == cache->entries[i].sectionID) &&
+                (offset == cache->entries[i].offset))
+            {
+                entry = &cache->entries[i];
+                break;
+            }
+            if ((0 == cache->entries[i].valid) ||
+                ((0 != entry->valid) && (cache->entries[i].lastUse < entry->lastUse)))
+            {
+                entry = &cache->entries[i];
+            }
+        }
+
+        if (i < QLIB_SEC_READ_CACHE_SIZE)
+        {
+            cache->hits++;
+        }
+        else
+        {
+            /*---------------------------------------------------------------------------------------------*/
+            /* Evict the replaced page and read the page from flash                                        */
+            /*---------------------------------------------------------------------------------------------*/
+            memset(entry, 0, sizeof(QLIB_SEC_READ_CACHE_ENTRY_T));
+            cache->misses++;
+            QLIB_STATUS_RET_CHECK(QLIB_CMD_PROC__SRD(qlibContext, offset, entry->data));
+            entry->sectionID = (U8)sectionID;
+            entry->offset    = offset;
+            entry->valid     = 1;
+        }
+        entry->lastUse = ++cache->tick;
+
+        memcpy(buf, (U8*)(entry->data) + offsetInPage, iterSize);
+
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Prepare pointers for next iteration                                                             */
+        /*-------------------------------------------------------------------------------------------------*/
+        size         = size - iterSize;
+        buf          = buf + iterSize;
+        offset       = offset + QLIB_SEC_READ_PAGE_SIZE_BYTE;
+        offsetInPage = 0;
+        iterSize     = MIN(size, QLIB_SEC_READ_PAGE_SIZE_BYTE);
+    }
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_SEC_READ_CACHE_SIZE
+
+/************************************************************************************************************
+ * @brief       This function copies data from consecutive write fragments and advances the fragments position
+ *
+ * @param       fragment         Current fragment, updated to the fragment of the next data
+ * @param       fragmentOffset   Offset in current fragment, updated to the offset of the next data
+ * @param       dst              Output buffer
+ * @param       size             Size to copy
+************************************************************************************************************/
+static void QLIB_SEC_GatherFragments_L(const QLIB_WRITE_FRAGMENT_T** fragment, U32* fragmentOffset, U8* dst, U32 size)
+{
+    U32 chunkSize = 0;
+
+    while (0 != size)
+    {
+        chunkSize = MIN(size, (*fragment)->size - *fragmentOffset);
+        memcpy(dst, (*fragment)->buf + *fragmentOffset, chunkSize);
+
+        dst             = dst + chunkSize;
+        size            = size - chunkSize;
+        *fragmentOffset = *fragmentOffset + chunkSize;
+
+        if (*fragmentOffset == (*fragment)->size)
+        {
+            *fragment       = *fragment + 1;
+            *fragmentOffset = 0;
+        }
+    }
+}
+
+/************************************************************************************************************
+ * @brief       This function finds the first page, at or after given offset, needed by the read ranges
+ *
+ * @param       ranges       Array of read ranges, only ranges with QLIB_STATUS__OK status are considered
+ * @param       count        Number of ranges
+ * @param       fromOffset   Page aligned section offset to search from
+ * @param       pageOffset   Output - page aligned section offset of the found page
+ *
+ * @return      TRUE if a page was found, FALSE otherwise
+************************************************************************************************************/
+static BOOL QLIB_SEC_ReadVNextPage_L(const QLIB_READ_RANGE_T* ranges, U32 count, U32 fromOffset, U32* pageOffset)
+{
+    U32  i     = 0;
+    U32  start = 0;
+    BOOL found = FALSE;
+
+    for (i = 0; i < count; i++)
+    {
+        if ((QLIB_STATUS__OK == ranges[i].status) && ((ranges[i].offset + ranges[i].size) > fromOffset))
+        {
+            start = MAX(ranges[i].offset, fromOffset);
+            if ((FALSE == found) || (start < *pageOffset))
+            {
+                *pageOffset = start;
+                found       = TRUE;
+            }
+        }
+    }
+
+    if (TRUE == found)
+    {
+        *pageOffset = *pageOffset - (*pageOffset % QLIB_SEC_READ_PAGE_SIZE_BYTE);
+    }
+
+    return found;
+}
+
+/************************************************************************************************************
+ * @brief       This function copies a read page to all the read ranges it covers
+ *
+ * @param       ranges       Array of read ranges, only ranges with QLIB_STATUS__OK status are updated
+ * @param       count        Number of ranges
+ * @param       pageOffset   Page aligned section offset of the page
+ * @param       page         Page data
+************************************************************************************************************/
+static void QLIB_SEC_ReadVCopyPage_L(QLIB_READ_RANGE_T* ranges, U32 count, U32 pageOffset, const U8* page)
+{
+    U32 i     = 0;
+    U32 start = 0;
+    U32 end   = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        if (QLIB_STATUS__OK == ranges[i].status)
+        {
+            start = MAX(ranges[i].offset, pageOffset);
+            end   = MIN(ranges[i].offset + ranges[i].size, pageOffset + QLIB_SEC_READ_PAGE_SIZE_BYTE);
+            if (start < end)
+            {
+                memcpy(ranges[i].buf + (start - ranges[i].offset), page + (start - pageOffset), end - start);
+            }
+        }
+    }
+}
+
+/************************************************************************************************************
+ * @brief       This function sets the status of the read ranges which end after given offset
+ *
+ * @param       ranges       Array of read ranges, only ranges with QLIB_STATUS__OK status are updated
+ * @param       count        Number of ranges
+ * @param       fromOffset   Section offset
+ * @param       status       Status to set
+************************************************************************************************************/
+static void QLIB_SEC_ReadVSetStatus_L(QLIB_READ_RANGE_T* ranges, U32 count, U32 fromOffset, QLIB_STATUS_T status)
+{
+    U32 i = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        if ((QLIB_STATUS__OK == ranges[i].status) && ((ranges[i].offset + ranges[i].size) > fromOffset))
+        {
+            ranges[i].status = status;
+        }
+    }
+}
+
+#if !defined QLIB_SUPPORT_XIP && defined QLIB_SEC_READ_AHEAD_ENABLED
+/************************************************************************************************************
+ * @brief       This function performs aligned secure read with sequential read-ahead.
+ *              If the read continues the previous read, the secure read of the following page is left in
+ *              flight, to be consumed by the next sequential read or dropped by the next other command.
+ *
+ * @param       qlibContext     QLIB state object
+ * @param       buf             Pointer to 32 bytes aligned output buffer
+ * @param       sectionID       Section index
+ * @param       offset          Section offset, 32 bytes aligned
+ * @param       size            Size of read data, multiple of 32 bytes
+ *
+ * @return      QLIB_STATUS__OK on success or QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_SEC_ReadSequential_L(QLIB_CONTEXT_T* qlibContext, U32* buf, U32 sectionID, U32 offset, U32 size)
+{
+    QLIB_SEC_READ_AHEAD_T* readAhead   = &qlibContext->readAhead;
+    U32                    sectionSize = QLIB_REG_SMRn__LEN_IN_TAG_TO_BYTES(qlibContext->sectionsState[sectionID].sizeTag);
+    BOOL                   sequential  = ((sectionID == readAhead->sectionID) && (offset == readAhead->offset)) ? TRUE : FALSE;
+    BOOL                   started     = ((TRUE == sequential) && (0 != readAhead->pending)) ? TRUE : FALSE;
+    BOOL                   nextRead    = FALSE;
+    QLIB_STATUS_T          ret         = QLIB_STATUS__OK;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Read ahead only sequential streams and never beyond the section end                                 */
+    /*-----------------------------------------------------------------------------------------------------*/
+    nextRead = ((TRUE == sequential) && ((offset + size + QLIB_SEC_READ_PAGE_SIZE_BYTE) <= sectionSize)) ? TRUE : FALSE;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Consume the in-flight read, a non matching read-ahead is dropped by the transport layer             */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (TRUE == started)
+    {
+        readAhead->pending = 0;
+    }
+
+    ret = QLIB_CMD_PROC__SRD_Multi_ReadAhead(qlibContext, offset, buf, size, started, nextRead);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Read-ahead is left in flight only on success, a failed read drains it                               */
+    /*-----------------------------------------------------------------------------------------------------*/
+    readAhead->pending   = (U8)BOOLEAN_TO_INT((QLIB_STATUS__OK == ret) && (TRUE == nextRead));
+    readAhead->sectionID = (U8)((QLIB_STATUS__OK == ret) ? sectionID : QLIB_NUM_OF_SECTIONS);
+    readAhead->offset    = offset + size;
+
+    return ret;
+}
+#endif // !QLIB_SUPPORT_XIP && QLIB_SEC_READ_AHEAD_ENABLED
+
+#ifdef QLIB_SEC_READ_DIGEST_AUTH_ENABLED
+/************************************************************************************************************
+ * @brief       This function checks if a read covers the whole area of the section digest, i.e. the whole
+ *              section, or the active half of a rollback protected section
+ *
+ * @param       qlibContext   QLIB state object
+ * @param       sectionID     Section index
+ * @param       offset        Section offset
+ * @param       size          Size of read data
+ *
+ * @return      TRUE if the read covers exactly the section digest area, FALSE otherwise
+************************************************************************************************************/
+static BOOL QLIB_SEC_ReadIsDigestArea_L(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U32 offset, U32 size)
+{
+    U32           sectionSize = QLIB_REG_SMRn__LEN_IN_TAG_TO_BYTES(qlibContext->sectionsState[sectionID].sizeTag);
+    QLIB_POLICY_T policy;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* The section policy is read only for reads which may cover the digest area                          */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if ((0 != offset) || ((sectionSize != size) && ((sectionSize / 2) != size)))
+    {
+        return FALSE;
+    }
+
+    if (QLIB_STATUS__OK !=
+        QLIB_SEC_GetSectionConfiguration(qlibContext, sectionID, NULL, NULL, &policy, NULL, NULL, NULL))
+    {
+        return FALSE;
+    }
+
+    return (size == ((1 == policy.rollbackProt) ? (sectionSize / 2) : sectionSize)) ? TRUE : FALSE;
+}
+
+/************************************************************************************************************
+ * @brief       This function reads the section digest area by non-authenticated secure reads while hashing
+ *              the data, and authenticates the whole data by a single section digest calculated by the device.
+ *              On any error the output buffer is cleared.
+ *
+ * @param       qlibContext   QLIB state object
+ * @param       buf           Pointer to output buffer
+ * @param       sectionID     Section index
+ * @param       size          Size of the section digest area
+ *
+ * @return      QLIB_STATUS__OK on success, QLIB_STATUS__SECURITY_ERR if the digest mismatches or
+ *              QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_SEC_ReadDigestAuth_L(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID, U32 size)
+{
+    PLAT_HASH_CTX_T hashCtx;
+    _256BIT         hash;
+    U32             readSize  = 0;
+    U32             chunkSize = 0;
+    QLIB_STATUS_T   ret       = QLIB_STATUS__OK;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Read in chunks, each chunk is hashed while it is still in cache                                     */
+    /*-----------------------------------------------------------------------------------------------------*/
+    PLAT_HASH_Init(&hashCtx);
+
+    while (readSize < size)
+    {
+        chunkSize = MIN(size - readSize, QLIB_SEC_READ_DIGEST_AUTH_CHUNK);
+        QLIB_STATUS_RET_CHECK_GOTO(QLIB_SEC_Read(qlibContext, buf + readSize, sectionID, readSize, chunkSize, FALSE),
+                                   ret,
+                                   error);
+        PLAT_HASH_Update(&hashCtx, buf + readSize, chunkSize);
+        readSize += chunkSize;
+    }
+
+    PLAT_HASH_Final(&hashCtx, hash);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Authenticate the whole data by the section digest                                                   */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_SEC_VerifySectionDigest(qlibContext, sectionID, hash), ret, error);
+
+    return QLIB_STATUS__OK;
+
+error:
+    memset(buf, 0, size);
+    return ret;
+}
+#endif // QLIB_SEC_READ_DIGEST_AUTH_ENABLED
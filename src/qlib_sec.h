@@ -78,6 +78,15 @@ extern "C" {
     (context_p)->mc[TC]++;                   \
     QLIB_ASSERT_RET((context_p)->mc[TC] != 0, QLIB_STATUS__DEVICE_MC_ERR)
 
+/*---------------------------------------------------------------------------------------------------------*/
+/* Cached decrypted pages are dropped on every flow that may change the flash data or the session          */
+/*---------------------------------------------------------------------------------------------------------*/
+#ifdef QLIB_SEC_READ_CACHE_SIZE
+#define QLIB_SEC_READ_CACHE_INVALIDATE(context_p) QLIB_SEC_ReadCacheInvalidate(context_p)
+#else
+#define QLIB_SEC_READ_CACHE_INVALIDATE(context_p)
+#endif
+
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                           INTERFACE FUNCTIONS                                           */
@@ -104,6 +113,37 @@ QLIB_STATUS_T QLIB_SEC_InitLib(QLIB_CONTEXT_T* qlibContext);
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_SEC_SyncState(QLIB_CONTEXT_T* qlibContext);
 
+/************************************************************************************************************
+ * @brief       This function saves the synchronized secure module state in a device state object
+ *
+ * @param[in]   qlibContext   qlib context object
+ * @param[out]  deviceState   device state object
+ *
+ * @return      QLIB_STATUS__OK on success or QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SEC_ExportDeviceState(QLIB_CONTEXT_T* qlibContext, QLIB_DEVICE_STATE_T* deviceState);
+
+/************************************************************************************************************
+ * @brief       This function restores the secure module state from a device state object instead of
+ *              reading it from the flash (see @ref QLIB_SEC_SyncState).
+ *              The device state is range checked and validated by reading the Winbond ID once and comparing
+ *              it to the Winbond ID already stored in the context. Only then the secure module is synchronized
+ *              after reset (see @ref QLIB_SEC_SyncAfterFlashReset), waiting at most
+ *              QLIB_SEC_IMPORT_STATE_MAX_POLLS secure status polls. The device must be powered up.
+ *
+ * @param[in,out]   qlibContext   qlib context object
+ * @param[in]       deviceState   device state object
+ *
+ * @return
+ * QLIB_STATUS__OK on success\n
+ * QLIB_STATUS__INVALID_PARAMETER if the device state is out of range\n
+ * QLIB_STATUS__SYSTEM_IN_INCORRECT_STATE if the device state does not match the connected flash, or the secure
+ * status still reports an error after the polls\n
+ * QLIB_STATUS__DEVICE_BUSY if the secure module is still busy after the polls\n
+ * QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SEC_ImportDeviceState(QLIB_CONTEXT_T* qlibContext, const QLIB_DEVICE_STATE_T* deviceState);
+
 /************************************************************************************************************
  * @brief       This function formats the flash device, including keys and sections configurations.
  *              If deviceMasterKey is available then secure format (SFORMAT) command is used,
@@ -150,6 +190,20 @@ QLIB_STATUS_T QLIB_SEC_GetNotifications(QLIB_CONTEXT_T* qlibContext, QLIB_NOTIFI
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_SEC_PerformMCMaint(QLIB_CONTEXT_T* qlibContext);
 
+#ifdef QLIB_MAINT_SCHED_ENABLED
+/************************************************************************************************************
+ * @brief       This function performs the monotonic counter maintenance iterations needed according to the
+ *              last SSR, as long as the next iteration fits in the idle window. The iteration time is measured.
+ *
+ * @param[in,out]   qlibContext   qlib context object
+ * @param[in]       idleUs        Idle window, in microseconds
+ * @param[out]      pending       TRUE if maintenance is still needed
+ *
+ * @return      QLIB_STATUS__OK on success or QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SEC_PerformMCMaintIdle(QLIB_CONTEXT_T* qlibContext, U32 idleUs, BOOL* pending);
+#endif
+
 /************************************************************************************************************
  * @brief       This function re-configures the flash. It assume clean/formatted flash if keys are provided.
  *              The 'restrictedKeys' and 'fullAccessKeys' can be NULL or contain invalid (zero) key elements
@@ -285,6 +339,21 @@ QLIB_STATUS_T QLIB_SEC_AuthPlainAccess_Revoke(QLIB_CONTEXT_T* qlibContext, U32 s
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_SEC_Read(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID, U32 offset, U32 size, BOOL auth);
 
+/************************************************************************************************************
+ * @brief       This function performs secure read of multiple ranges from one section.
+ *              Each page needed by the ranges is read once. A session must be open first
+ *
+ * @param       qlibContext    QLIB state object
+ * @param       ranges         Array of read ranges, only ranges with QLIB_STATUS__OK status are read.
+ *                             On error, the status of the ranges which were not read is set to the error
+ * @param       count          Number of ranges
+ * @param       sectionID      Section index
+ * @param       auth           if TRUE, read operation will be authenticated
+ *
+ * @return      QLIB_STATUS__OK on success or QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SEC_ReadV(QLIB_CONTEXT_T* qlibContext, QLIB_READ_RANGE_T* ranges, U32 count, U32 sectionID, BOOL auth);
+
 /************************************************************************************************************
  * @brief       This function perform secure write data to the flash.
  *
@@ -298,6 +367,26 @@ QLIB_STATUS_T QLIB_SEC_Read(QLIB_CONTEXT_T* qlibContext, U8* buf, U32 sectionID,
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_SEC_Write(QLIB_CONTEXT_T* qlibContext, const U8* buf, U32 sectionID, U32 offset, U32 size);
 
+/************************************************************************************************************
+ * @brief       This function perform secure write of data gathered from multiple fragments to the flash.
+ *              Each page is built directly from the fragments.
+ *
+ * @param       qlibContext   QLIB state object
+ * @param       fragments     Array of data fragments, written one after the other
+ * @param       count         Number of fragments
+ * @param       sectionID     Section index
+ * @param       offset        Section offset
+ * @param       size          Data size, the total size of the fragments
+ *
+ * @return      QLIB_STATUS__OK on success or QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SEC_WriteV(QLIB_CONTEXT_T*              qlibContext,
+                              const QLIB_WRITE_FRAGMENT_T* fragments,
+                              U32                          count,
+                              U32                          sectionID,
+                              U32                          offset,
+                              U32                          size);
+
 /************************************************************************************************************
  * @brief       This function erases data from the flash
  *
@@ -369,6 +458,30 @@ QLIB_STATUS_T QLIB_SEC_RemoveKey(QLIB_CONTEXT_T* qlibContext, U32 sectionID, BOO
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_SEC_CheckIntegrity(QLIB_CONTEXT_T* qlibContext, U32 sectionID, QLIB_INTEGRITY_T integrityType);
 
+/************************************************************************************************************
+ * @brief       This function returns the section digest calculated by the device over the section content
+ *
+ * @param       qlibContext     QLIB state object
+ * @param       sectionID       Section index
+ * @param[out]  digest          Section digest
+ *
+ * @return      QLIB_STATUS__OK on success or QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SEC_CalcSectionDigest(QLIB_CONTEXT_T* qlibContext, U32 sectionID, U64* digest);
+
+/************************************************************************************************************
+ * @brief       This function authenticates data read from the section digest area by comparing its hash with
+ *              the section digest calculated by the device
+ *
+ * @param       qlibContext     QLIB state object
+ * @param       sectionID       Section index
+ * @param       hash            Hash of the whole section digest area, calculated by PLAT_HASH
+ *
+ * @return      QLIB_STATUS__OK on success, QLIB_STATUS__SECURITY_ERR if the digest mismatches or
+ *              QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SEC_VerifySectionDigest(QLIB_CONTEXT_T* qlibContext, U32 sectionID, const _256BIT hash);
+
 /************************************************************************************************************
  * @brief       This function returns CDI value
  *
@@ -510,6 +623,28 @@ QLIB_STATUS_T QLIB_SEC_SyncAfterFlashReset(QLIB_CONTEXT_T* qlibContext);
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_SEC_EnablePlainAccess(QLIB_CONTEXT_T* qlibContext, U32 sectionID);
 
+#ifdef QLIB_SEC_READ_CACHE_SIZE
+/************************************************************************************************************
+ * @brief       This function enables or disables the secure read cache for the given section.
+ *              Caching is not allowed for sections with plain write access, since their content may be
+ *              changed without QLIB knowledge.
+ *
+ * @param       qlibContext     QLIB state object
+ * @param       sectionID       Section index
+ * @param       enable          TRUE to enable caching, FALSE to disable it
+ *
+ * @return      QLIB_STATUS__OK on success or QLIB_STATUS__[ERROR] otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_SEC_ReadCacheEnable(QLIB_CONTEXT_T* qlibContext, U32 sectionID, BOOL enable);
+
+/************************************************************************************************************
+ * @brief       This function drops and zeroizes all the cached decrypted pages
+ *
+ * @param       qlibContext     QLIB state object
+************************************************************************************************************/
+void QLIB_SEC_ReadCacheInvalidate(QLIB_CONTEXT_T* qlibContext);
+#endif // QLIB_SEC_READ_CACHE_SIZE
+
 
 
 #ifdef __cplusplus
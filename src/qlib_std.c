@@ -70,6 +70,10 @@ static U8 QLIB_STD_GetReadDummyCyclesCMD_L(QLIB_BUS_MODE_T busMode, BOOL dtr, U3
 static QLIB_STATUS_T QLIB_STD_CheckWritePrivilege_L(QLIB_CONTEXT_T* qlibContext, U32 logicalAddr);
 #endif // QLIB_SUPPORT_QPI
 #endif // QLIB_SEC_ONLY
+#ifdef QLIB_STD_SFDP_ENABLED
+static QLIB_STATUS_T QLIB_STD_ReadSfdpData_L(QLIB_CONTEXT_T* qlibContext, U32 address, U8* data, U32 size);
+static void          QLIB_STD_ParseSfdp_L(const U32* dwords, U32 numDwords, QLIB_SFDP_T* sfdp);
+#endif // QLIB_STD_SFDP_ENABLED
 
 
 BOOL QLIB_STD_AutoSenseCheckBusMode_L(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_MODE_T busMode);
@@ -158,6 +162,13 @@ QLIB_STATUS_T QLIB_STD_execute_std_cmd_L(QLIB_CONTEXT_T* qlibContext,
 
 QLIB_STATUS_T QLIB_STD_AutoSense(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_MODE_T* busMode)
 {
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* The flash may still be in continuous read mode, reset it before the first instruction              */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(QLIB_STD_ContinuousReadReset(qlibContext));
+#endif
+
     /*-----------------------------------------------------------------------------------------------------*/
     /* Release power down and check non-QPI mode                                                           */
     /*-----------------------------------------------------------------------------------------------------*/
@@ -221,6 +232,29 @@ QLIB_STATUS_T QLIB_STD_AutoSense(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_MODE_T* b
     return QLIB_STATUS__CONNECTIVITY_ERR;
 }
 
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+QLIB_STATUS_T QLIB_STD_ContinuousReadReset(QLIB_CONTEXT_T* qlibContext)
+{
+    U8 modeReset = SPI_FLASH_CMD__CONTINUOUS_READ_RESET;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Not subject to the power down state, a flash in power down ignores the sequence                     */
+    /*-----------------------------------------------------------------------------------------------------*/
+    return QLIB_TM_Standard(qlibContext,
+                            QLIB_BUS_FORMAT(QLIB_BUS_MODE_1_1_1, FALSE, FALSE),
+                            FALSE,
+                            FALSE,
+                            SPI_FLASH_CMD__CONTINUOUS_READ_RESET,
+                            NULL,
+                            &modeReset,
+                            1,
+                            0,
+                            NULL,
+                            0,
+                            NULL);
+}
+#endif // QLIB_STD_CONTINUOUS_READ_ENABLED
+
 QLIB_STATUS_T QLIB_STD_SetInterface(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_FORMAT_T busFormat)
 {
 #ifdef QLIB_SUPPORT_QPI
@@ -291,6 +325,26 @@ QLIB_STATUS_T QLIB_STD_Read(QLIB_CONTEXT_T* qlibContext, U8* output, U32 logical
     /*-----------------------------------------------------------------------------------------------------*/
     readCMD = QLIB_STD_GetReadCMD_L(qlibContext, &dummyCycles, &format);
 
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Consecutive dual and quad I/O reads keep the flash in continuous read mode, skipping the instruction */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (TRUE == qlibContext->continuousReadEnabled &&
+        (SPI_FLASH_CMD__READ_FAST__1_4_4 == readCMD || SPI_FLASH_CMD__READ_FAST__1_2_2 == readCMD) &&
+        FALSE == QLIB_VALUE_BY_FLASH_TYPE(qlibContext,
+                                          qlibContext->isPoweredDown,
+                                          qlibContext->stdState[qlibContext->activeDie - 1].isPoweredDown))
+    {
+        return QLIB_TM_StandardContinuousRead(qlibContext,
+                                              QLIB_BUS_FORMAT(format, qlibContext->busInterface.dtr, FALSE),
+                                              readCMD,
+                                              logicalAddr,
+                                              dummyCycles,
+                                              output,
+                                              size);
+    }
+#endif
+
     /*-----------------------------------------------------------------------------------------------------*/
     /* Perform read                                                                                        */
     /*-----------------------------------------------------------------------------------------------------*/
@@ -464,21 +518,7 @@ QLIB_STATUS_T QLIB_STD_Erase(QLIB_CONTEXT_T* qlibContext, U32 logicalAddr, U32 s
     /*-----------------------------------------------------------------------------------------------------*/
     while (0 < size)
     {
-        if (_64KB_ <= size && 0 == (logicalAddr % _64KB_))
-        {
-            eraseSize = _64KB_;
-            eraseType = QLIB_ERASE_BLOCK_64K;
-        }
-        else if (_32KB_ <= size && 0 == (logicalAddr % _32KB_))
-        {
-            eraseSize = _32KB_;
-            eraseType = QLIB_ERASE_BLOCK_32K;
-        }
-        else
-        {
-            eraseSize = FLASH_SECTOR_SIZE;
-            eraseType = QLIB_ERASE_SECTOR_4K;
-        }
+        eraseType = QLIB_STD_GetEraseType(qlibContext, logicalAddr, size, &eraseSize);
 
         /*-------------------------------------------------------------------------------------------------*/
         /* Start erase                                                                                     */
@@ -635,6 +675,43 @@ QLIB_STATUS_T QLIB_STD_Power(QLIB_CONTEXT_T* qlibContext, QLIB_POWER_T power)
 
     return QLIB_STATUS__OK;
 }
+
+#ifdef QLIB_BUS_TUNE_ENABLED
+QLIB_STATUS_T QLIB_STD_SetReadParameters(QLIB_CONTEXT_T* qlibContext, U8 dummyCycles)
+{
+    U8 readParams;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(QLIB_BUS_MODE_4_4_4 == qlibContext->busInterface.busMode, QLIB_STATUS__SYSTEM_IN_INCORRECT_STATE);
+    QLIB_ASSERT_RET(0 == dummyCycles || (2 <= dummyCycles && 8 >= dummyCycles && 0 == (dummyCycles % 2)),
+                    QLIB_STATUS__INVALID_PARAMETER);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* P5-P4 select 2, 4, 6 or 8 dummy clocks, P1-P0 keep the default wrap length                          */
+    /*-----------------------------------------------------------------------------------------------------*/
+    readParams = (U8)(((((0 == dummyCycles) ? SPI_FLASH_DUMMY_CYCLES__FAST_READ__4_4_4 : dummyCycles) / 2) - 1) << 4);
+
+    QLIB_STATUS_RET_CHECK(QLIB_STD_execute_std_cmd_L(qlibContext,
+                                                     QLIB_BUS_MODE_4_4_4,
+                                                     FALSE,
+                                                     FALSE,
+                                                     FALSE,
+                                                     SPI_FLASH_CMD__SET_READ_PARAMETERS,
+                                                     NULL,
+                                                     &readParams,
+                                                     1,
+                                                     0,
+                                                     NULL,
+                                                     0,
+                                                     NULL));
+
+    qlibContext->qpiReadDummyCycles = dummyCycles;
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_BUS_TUNE_ENABLED
 #endif // QLIB_SEC_ONLY
 
 QLIB_STATUS_T QLIB_STD_ResetFlash(QLIB_CONTEXT_T* qlibContext, BOOL forceReset)
@@ -642,6 +719,9 @@ QLIB_STATUS_T QLIB_STD_ResetFlash(QLIB_CONTEXT_T* qlibContext, BOOL forceReset)
     STD_FLASH_STATUS_T status;
     QLIB_BUS_MODE_T    preResetFormat = QLIB_STD_GET_BUS_MODE(qlibContext);
     QLIB_STATUS_T      ret            = QLIB_STATUS__OK;
+#ifdef QLIB_PLAT_WAIT_ENABLED
+    U32 pollCount = 0;
+#endif
     INTERRUPTS_VAR_DECLARE(ints);
 
     if (TRUE == forceReset)
@@ -671,6 +751,13 @@ QLIB_STATUS_T QLIB_STD_ResetFlash(QLIB_CONTEXT_T* qlibContext, BOOL forceReset)
                 /*-----------------------------------------------------------------------------------------*/
                 QLIB_STATUS_RET_CHECK_GOTO(QLIB_STD_GetStatus_L(qlibContext, &status), ret, error);
 
+#ifdef QLIB_PLAT_WAIT_ENABLED
+                if (0 != READ_VAR_FIELD(status.SR1.asUint, SPI_FLASH__STATUS_1_FIELD__BUSY) ||
+                    0 != READ_VAR_FIELD(status.SR2.asUint, SPI_FLASH__STATUS_2_FIELD__SUS))
+                {
+                    QLIB_STATUS_RET_CHECK_GOTO(PLAT_SPI_WaitWhileBusy(qlibContext->userData, pollCount++), ret, error);
+                }
+#endif
             } while (0 != READ_VAR_FIELD(status.SR1.asUint, SPI_FLASH__STATUS_1_FIELD__BUSY) ||
                      0 != READ_VAR_FIELD(status.SR2.asUint, SPI_FLASH__STATUS_2_FIELD__SUS));
 
@@ -717,6 +804,10 @@ QLIB_STATUS_T QLIB_STD_ResetFlash(QLIB_CONTEXT_T* qlibContext, BOOL forceReset)
                                                      NULL,
                                                      0,
                                                      NULL));
+#ifdef QLIB_BUS_TUNE_ENABLED
+    // Reset restores the default read parameters
+    qlibContext->qpiReadDummyCycles = 0;
+#endif
 
 
     INTERRUPTS_RESTORE(ints);
@@ -877,12 +968,298 @@ QLIB_STATUS_T QLIB_STD_GetMemoryType(QLIB_CONTEXT_T* qlibContext, U8* memType)
     return QLIB_STATUS__OK;
 }
 
+#ifdef QLIB_STD_SFDP_ENABLED
+QLIB_STATUS_T QLIB_STD_ReadSfdp(QLIB_CONTEXT_T* qlibContext, QLIB_SFDP_T* sfdp)
+{
+    QLIB_STATUS_T ret = QLIB_STATUS__OK;
+    U8            header[SPI_FLASH_SFDP_HEADER_SIZE];
+    U8            paramHeader[SPI_FLASH_SFDP_PARAM_HEADER_SIZE];
+    U8            params[SPI_FLASH_SFDP_BASIC_PARAMS_MAX_DWORDS * sizeof(U32)];
+    U32           dwords[SPI_FLASH_SFDP_BASIC_PARAMS_MAX_DWORDS];
+    U32           paramHeaderDw[2];
+    U32           numParamHeaders;
+    U32           numDwords = 0;
+    U32           i;
+
+#ifdef QLIB_SUPPORT_QPI
+    BOOL exitQpi = FALSE;
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* SPI_FLASH_CMD__READ_SFDP_TABLE is supported only in SPI mode                                        */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (QLIB_BUS_MODE_4_4_4 == qlibContext->busInterface.busMode)
+    {
+        QLIB_STATUS_RET_CHECK(
+            QLIB_SetInterface(qlibContext, QLIB_BUS_FORMAT(QLIB_BUS_MODE_1_1_1, qlibContext->busInterface.dtr, TRUE)));
+        exitQpi = TRUE;
+    }
+#endif //QLIB_SUPPORT_QPI
+
+    memset(sfdp, 0, sizeof(QLIB_SFDP_T));
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Read the SFDP header, no SFDP support is not an error                                               */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_STD_ReadSfdpData_L(qlibContext, 0, header, sizeof(header)), ret, error);
+    if (SPI_FLASH_SFDP_SIGNATURE != MAKE_32_BIT(header[0], header[1], header[2], header[3]))
+    {
+        goto error;
+    }
+    numParamHeaders = READ_VAR_FIELD(MAKE_32_BIT(header[4], header[5], header[6], header[7]),
+                                     SPI_FLASH_SFDP_HEADER_FIELD__NPH) +
+                      1;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Find the JEDEC basic flash parameter table                                                          */
+    /*-----------------------------------------------------------------------------------------------------*/
+    for (i = 0; i < numParamHeaders; i++)
+    {
+        QLIB_STATUS_RET_CHECK_GOTO(QLIB_STD_ReadSfdpData_L(qlibContext,
+                                                           SPI_FLASH_SFDP_HEADER_SIZE + i * SPI_FLASH_SFDP_PARAM_HEADER_SIZE,
+                                                           paramHeader,
+                                                           sizeof(paramHeader)),
+                                   ret,
+                                   error);
+        paramHeaderDw[0] = MAKE_32_BIT(paramHeader[0], paramHeader[1], paramHeader[2], paramHeader[3]);
+        paramHeaderDw[1] = MAKE_32_BIT(paramHeader[4], paramHeader[5], paramHeader[6], paramHeader[7]);
+        if (SPI_FLASH_SFDP_BASIC_PARAMS_ID_LSB == READ_VAR_FIELD(paramHeaderDw[0], SPI_FLASH_SFDP_PARAM_HEADER_FIELD__ID_LSB) &&
+            SPI_FLASH_SFDP_BASIC_PARAMS_ID_MSB == READ_VAR_FIELD(paramHeaderDw[1], SPI_FLASH_SFDP_PARAM_HEADER_FIELD__ID_MSB))
+        {
+            numDwords = MIN(READ_VAR_FIELD(paramHeaderDw[0], SPI_FLASH_SFDP_PARAM_HEADER_FIELD__LENGTH),
+                            SPI_FLASH_SFDP_BASIC_PARAMS_MAX_DWORDS);
+            break;
+        }
+    }
+    if (0 == numDwords)
+    {
+        goto error;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Read and parse the table                                                                            */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_STD_ReadSfdpData_L(qlibContext,
+                                                       READ_VAR_FIELD(paramHeaderDw[1], SPI_FLASH_SFDP_PARAM_HEADER_FIELD__PTR),
+                                                       params,
+                                                       numDwords * sizeof(U32)),
+                               ret,
+                               error);
+    for (i = 0; i < numDwords; i++)
+    {
+        dwords[i] = MAKE_32_BIT(params[i * 4], params[i * 4 + 1], params[i * 4 + 2], params[i * 4 + 3]);
+    }
+    QLIB_STD_ParseSfdp_L(dwords, numDwords, sfdp);
+
+error:
+#ifdef QLIB_SUPPORT_QPI
+    if (exitQpi)
+    {
+        QLIB_STATUS_RET_CHECK(
+            QLIB_SetInterface(qlibContext, QLIB_BUS_FORMAT(QLIB_BUS_MODE_4_4_4, qlibContext->busInterface.dtr, TRUE)));
+    }
+#endif
+    return ret;
+}
+#endif // QLIB_STD_SFDP_ENABLED
+
+QLIB_ERASE_T QLIB_STD_GetEraseType(QLIB_CONTEXT_T* qlibContext, U32 address, U32 size, U32* eraseSize)
+{
+#ifdef QLIB_STD_SFDP_ENABLED
+    const U32          sizes[] = {_64KB_, _32KB_, _4KB_};
+    const QLIB_ERASE_T types[] = {QLIB_ERASE_BLOCK_64K, QLIB_ERASE_BLOCK_32K, QLIB_ERASE_SECTOR_4K};
+    QLIB_ERASE_T       eraseType    = QLIB_ERASE_FIRST;
+    U32                bestSectorUs = 0;
+    U32                sectorUs;
+    U32                typicalUs;
+    BOOL               listed;
+    U32                c;
+    U32                t;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Select the fitting erase type with the lowest typical time per sector, larger type on a tie.        */
+    /* Erase types which are not listed by the device are skipped                                          */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (TRUE == qlibContext->sfdp.valid)
+    {
+        for (c = 0; c < ARRAY_SIZE(sizes); c++)
+        {
+            if (sizes[c] > size || 0 != (address % sizes[c]))
+            {
+                continue;
+            }
+            listed    = FALSE;
+            typicalUs = 0;
+            for (t = 0; t < QLIB_SFDP_ERASE_TYPES; t++)
+            {
+                if (sizes[c] == qlibContext->sfdp.eraseSize[t])
+                {
+                    listed    = TRUE;
+                    typicalUs = qlibContext->sfdp.eraseTypicalUs[t];
+                }
+            }
+            if (FALSE == listed)
+            {
+                continue;
+            }
+            // unknown typical time keeps the larger type
+            sectorUs = typicalUs / (sizes[c] / _4KB_);
+            if (QLIB_ERASE_FIRST == eraseType || (0 != sectorUs && sectorUs < bestSectorUs))
+            {
+                eraseType    = types[c];
+                *eraseSize   = sizes[c];
+                bestSectorUs = sectorUs;
+            }
+        }
+        if (QLIB_ERASE_FIRST != eraseType)
+        {
+            return eraseType;
+        }
+    }
+#else
+    TOUCH(qlibContext);
+#endif // QLIB_STD_SFDP_ENABLED
+
+    if (_64KB_ <= size && 0 == (address % _64KB_))
+    {
+        *eraseSize = _64KB_;
+        return QLIB_ERASE_BLOCK_64K;
+    }
+    else if (_32KB_ <= size && 0 == (address % _32KB_))
+    {
+        *eraseSize = _32KB_;
+        return QLIB_ERASE_BLOCK_32K;
+    }
+    else
+    {
+        *eraseSize = _4KB_;
+        return QLIB_ERASE_SECTOR_4K;
+    }
+}
+
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                             LOCAL FUNCTIONS                                             */
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 
+#ifdef QLIB_STD_SFDP_ENABLED
+/************************************************************************************************************
+ * @brief       This routine reads data from the SFDP area, in single SPI
+ *
+ * @param       qlibContext   qlib context object
+ * @param[in]   address       SFDP address
+ * @param[out]  data          read data
+ * @param[in]   size          read size
+ *
+ * @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_STD_ReadSfdpData_L(QLIB_CONTEXT_T* qlibContext, U32 address, U8* data, U32 size)
+{
+    QLIB_STATUS_RET_CHECK(QLIB_STD_execute_std_cmd_L(qlibContext,
+                                                     QLIB_BUS_MODE_1_1_1,
+                                                     FALSE,
+                                                     FALSE,
+                                                     FALSE,
+                                                     SPI_FLASH_CMD__READ_SFDP_TABLE,
+                                                     &address,
+                                                     NULL,
+                                                     0,
+                                                     SPI_FLASH_DUMMY_CYCLES__SFDP_TABLE,
+                                                     data,
+                                                     size,
+                                                     QLIB_VALUE_BY_FLASH_TYPE(qlibContext, &qlibContext->ssr, NULL)));
+
+    QLIB_EXECUTE_FOR_SECURE_FLASH_ONLY(qlibContext,
+                                       QLIB_STATUS_RET_CHECK(
+                                           QLIB_CMD_PROC__checkLastSsrErrors(qlibContext, SSR_MASK__ALL_ERRORS)));
+
+    return QLIB_STATUS__OK;
+}
+
+/************************************************************************************************************
+ * @brief       This routine parses the JEDEC basic flash parameter table (JESD216).
+ *              Tables older than JESD216 revision A do not hold the timing DWORDs, the times stay 0.
+ *
+ * @param[in]   dwords        Table DWORDs, DWORD 1 first
+ * @param[in]   numDwords     Number of DWORDs in the table
+ * @param[out]  sfdp          Parsed parameters
+************************************************************************************************************/
+static void QLIB_STD_ParseSfdp_L(const U32* dwords, U32 numDwords, QLIB_SFDP_T* sfdp)
+{
+    const U32 eraseUnitsUs[] = {1000, 16000, 128000, 1000000};
+    const U32 chipEraseUnitsUs[] = {16000, 256000, 4000000, 64000000};
+    const U32 programUnitsUs[]   = {8, 64};
+    U32       field;
+    U32       t;
+
+    if (numDwords < 9)
+    {
+        return;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Fast read modes (DWORD 1, 5)                                                                        */
+    /*-----------------------------------------------------------------------------------------------------*/
+    sfdp->fastReadModes = QLIB_SFDP_FAST_READ_BIT(QLIB_BUS_MODE_1_1_1);
+    if (0 != READ_VAR_FIELD(dwords[0], SPI_FLASH_SFDP_DW1_FIELD__FAST_READ_1_1_2))
+    {
+        sfdp->fastReadModes |= QLIB_SFDP_FAST_READ_BIT(QLIB_BUS_MODE_1_1_2);
+    }
+    if (0 != READ_VAR_FIELD(dwords[0], SPI_FLASH_SFDP_DW1_FIELD__FAST_READ_1_2_2))
+    {
+        sfdp->fastReadModes |= QLIB_SFDP_FAST_READ_BIT(QLIB_BUS_MODE_1_2_2);
+    }
+    if (0 != READ_VAR_FIELD(dwords[0], SPI_FLASH_SFDP_DW1_FIELD__FAST_READ_1_1_4))
+    {
+        sfdp->fastReadModes |= QLIB_SFDP_FAST_READ_BIT(QLIB_BUS_MODE_1_1_4);
+    }
+    if (0 != READ_VAR_FIELD(dwords[0], SPI_FLASH_SFDP_DW1_FIELD__FAST_READ_1_4_4))
+    {
+        sfdp->fastReadModes |= QLIB_SFDP_FAST_READ_BIT(QLIB_BUS_MODE_1_4_4);
+    }
+    if (0 != READ_VAR_FIELD(dwords[4], SPI_FLASH_SFDP_DW5_FIELD__FAST_READ_4_4_4))
+    {
+        sfdp->fastReadModes |= QLIB_SFDP_FAST_READ_BIT(QLIB_BUS_MODE_4_4_4);
+    }
+    sfdp->dtr = (U8)READ_VAR_FIELD(dwords[0], SPI_FLASH_SFDP_DW1_FIELD__DTR);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Erase types (DWORD 8, 9) and their typical times (DWORD 10)                                         */
+    /*-----------------------------------------------------------------------------------------------------*/
+    for (t = 0; t < QLIB_SFDP_ERASE_TYPES; t++)
+    {
+        field = READ_VAR_FIELD(dwords[7 + t / 2], SPI_FLASH_SFDP_ERASE_FIELD__SIZE(t));
+        if (0 == field || 31 < field)
+        {
+            continue;
+        }
+        sfdp->eraseSize[t] = 1u << field;
+        sfdp->eraseCmd[t]  = (U8)READ_VAR_FIELD(dwords[7 + t / 2], SPI_FLASH_SFDP_ERASE_FIELD__CMD(t));
+        if (10 <= numDwords)
+        {
+            field                   = READ_VAR_FIELD(dwords[9], SPI_FLASH_SFDP_DW10_FIELD__ERASE_TIME(t));
+            sfdp->eraseTypicalUs[t] = (READ_VAR_FIELD(field, SPI_FLASH_SFDP_TIME_FIELD__COUNT) + 1) *
+                                      eraseUnitsUs[READ_VAR_FIELD(field, SPI_FLASH_SFDP_TIME_FIELD__UNITS)];
+        }
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Page size, page program and chip erase typical times (DWORD 11)                                     */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (11 <= numDwords)
+    {
+        sfdp->pageSize = 1u << READ_VAR_FIELD(dwords[10], SPI_FLASH_SFDP_DW11_FIELD__PAGE_SIZE);
+        field          = READ_VAR_FIELD(dwords[10], SPI_FLASH_SFDP_DW11_FIELD__PROGRAM_TIME);
+        sfdp->pageProgramTypicalUs = (READ_VAR_FIELD(field, SPI_FLASH_SFDP_TIME_FIELD__COUNT) + 1) *
+                                     programUnitsUs[READ_VAR_FIELD(field, SPI_FLASH_SFDP_TIME_FIELD__UNITS) & 1];
+        field                    = READ_VAR_FIELD(dwords[10], SPI_FLASH_SFDP_DW11_FIELD__CHIP_ERASE_TIME);
+        sfdp->chipEraseTypicalUs = (READ_VAR_FIELD(field, SPI_FLASH_SFDP_TIME_FIELD__COUNT) + 1) *
+                                   chipEraseUnitsUs[READ_VAR_FIELD(field, SPI_FLASH_SFDP_TIME_FIELD__UNITS)];
+    }
+
+    sfdp->valid = TRUE;
+}
+#endif // QLIB_STD_SFDP_ENABLED
+
 /************************************************************************************************************
  * @brief       This routine sets the quad enable bit in the status register
  *
@@ -1142,6 +1519,8 @@ QLIB_STATUS_T QLIB_STD_EnterExitQPI_L(QLIB_CONTEXT_T* qlibContext, BOOL enter)
 
 U8 QLIB_STD_GetReadCMD_L(QLIB_CONTEXT_T* qlibContext, U32* dummyCycles, QLIB_BUS_MODE_T* format)
 {
+    U8 readCmd;
+
     *format = qlibContext->busInterface.busMode;
     if (TRUE == qlibContext->busInterface.dtr)
     {
@@ -1154,7 +1533,15 @@ U8 QLIB_STD_GetReadCMD_L(QLIB_CONTEXT_T* qlibContext, U32* dummyCycles, QLIB_BUS
             *format = QLIB_BUS_MODE_1_1_1;
         }
     }
-    return QLIB_STD_GetReadDummyCyclesCMD_L(*format, qlibContext->busInterface.dtr, dummyCycles);
+    readCmd = QLIB_STD_GetReadDummyCyclesCMD_L(*format, qlibContext->busInterface.dtr, dummyCycles);
+#ifdef QLIB_BUS_TUNE_ENABLED
+    if (QLIB_BUS_MODE_4_4_4 == *format && FALSE == qlibContext->busInterface.dtr && 0 != qlibContext->qpiReadDummyCycles)
+    {
+        // QPI read dummy cycles were changed by QLIB_STD_SetReadParameters
+        *dummyCycles = qlibContext->qpiReadDummyCycles;
+    }
+#endif
+    return readCmd;
 }
 
 /************************************************************************************************************
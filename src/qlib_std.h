@@ -94,6 +94,19 @@ QLIB_STATUS_T QLIB_STD_InitLib(QLIB_CONTEXT_T* qlibContext);
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_STD_AutoSense(QLIB_CONTEXT_T* qlibContext, QLIB_BUS_MODE_T* busMode);
 
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+/************************************************************************************************************
+ * @brief       This routine takes the flash out of continuous read mode, which may have been left active by a
+ *              previous host session. IO0 is kept high for 16 clocks, so the mode bits of a dual or quad I/O
+ *              continuous read end it, and a flash which is not in continuous read mode ignores the sequence.
+ *
+ * @param       qlibContext   qlib context
+ *
+ * @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_STD_ContinuousReadReset(QLIB_CONTEXT_T* qlibContext);
+#endif
+
 /************************************************************************************************************
  * @brief       This routine configures Flash interface configuration. If upgrade from single -> quad
  *              detected, quad hw is enabled. If detected quad -> single, hw quad is NOT disabled since to
@@ -202,6 +215,19 @@ QLIB_STATUS_T QLIB_STD_EraseResume(QLIB_CONTEXT_T* qlibContext, BOOL blocking) _
  * @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_STD_Power(QLIB_CONTEXT_T* qlibContext, QLIB_POWER_T power) __RAM_SECTION;
+
+#ifdef QLIB_BUS_TUNE_ENABLED
+/************************************************************************************************************
+ * @brief       This routine sets the read dummy cycles of the QPI fast read (Set Read Parameters command).
+ *              The flash must be in QPI mode. The setting is restored to the default by a flash reset.
+ *
+ * @param       qlibContext   qlib context object
+ * @param[in]   dummyCycles   2, 4, 6 or 8 dummy cycles, 0 for the default dummy cycles
+ *
+ * @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_STD_SetReadParameters(QLIB_CONTEXT_T* qlibContext, U8 dummyCycles);
+#endif // QLIB_BUS_TUNE_ENABLED
 #endif // QLIB_SEC_ONLY
 
 /************************************************************************************************************
@@ -250,6 +276,33 @@ QLIB_STATUS_T QLIB_STD_GetId(QLIB_CONTEXT_T* qlibContext, QLIB_STD_ID_T* id_p);
 * @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_STD_GetMemoryType(QLIB_CONTEXT_T* qlibContext, U8* memType);
+
+#ifdef QLIB_STD_SFDP_ENABLED
+/************************************************************************************************************
+* @brief       This routine reads and parses the JEDEC basic flash parameter table from the SFDP area.
+*              If the device has no SFDP or no basic parameter table, @p sfdp is returned not valid.
+*
+* @param       qlibContext   qlib context object
+* @param[out]  sfdp          (OUT) The discovered device parameters
+*
+* @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_STD_ReadSfdp(QLIB_CONTEXT_T* qlibContext, QLIB_SFDP_T* sfdp);
+#endif // QLIB_STD_SFDP_ENABLED
+
+/************************************************************************************************************
+* @brief       This routine selects the erase type for the beginning of an erase range.
+*              If SFDP parameters were discovered, the fitting erase type with the lowest typical time per sector is
+*              selected. Otherwise the largest aligned erase type that fits is selected.
+*
+* @param       qlibContext   qlib context object
+* @param[in]   address       Start address of the range, sector aligned
+* @param[in]   size          Range size, sector aligned and not 0
+* @param[out]  eraseSize     (OUT) Size erased by the selected erase type
+*
+* @return      Selected erase type
+************************************************************************************************************/
+QLIB_ERASE_T QLIB_STD_GetEraseType(QLIB_CONTEXT_T* qlibContext, U32 address, U32 size, U32* eraseSize);
 #ifdef __cplusplus
 }
 #endif
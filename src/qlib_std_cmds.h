@@ -125,6 +125,7 @@
 #define SPI_FLASH_CMD__READ_FAST_DTR__1_2_2  0xBD // DTR     - 6/8 Dummy clocks (Continuous Read Mode allowed)
 #define SPI_FLASH_CMD__READ_FAST_DTR__1_4_4  0xED // DTR     - 8 Dummy clocks (Continuous Read Mode allowed)
 #define SPI_FLASH_CMD__READ_FAST_DTR__4_4_4  0x0D // DTR+QPI - 8 Dummy clocks
+#define SPI_FLASH_CMD__CONTINUOUS_READ_RESET 0xFF // single  - FFFFh exits the Continuous Read Mode of any I/O read
 
 /*---------------------------------------------------------------------------------------------------------*/
 /* Write Instructions                                                                                      */
@@ -178,6 +179,36 @@
 #define SPI_FLASH__STATUS_1_FIELD__BUSY 0, 1 // ERASE/WRITE IN PROGRESS
 #define SPI_FLASH__STATUS_1_FIELD__WEL  1, 1 // WRITE ENABLE LATCH
 #define SPI_FLASH__STATUS_1_FIELD__BP   2, 3 // BLOCK PROTECT BITS
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* SFDP (JESD216) fields                                                                                   */
+/*---------------------------------------------------------------------------------------------------------*/
+#define SPI_FLASH_SFDP_SIGNATURE                  0x50444653 // "SFDP"
+#define SPI_FLASH_SFDP_HEADER_SIZE                8
+#define SPI_FLASH_SFDP_PARAM_HEADER_SIZE          8
+#define SPI_FLASH_SFDP_BASIC_PARAMS_ID_LSB        0x00
+#define SPI_FLASH_SFDP_BASIC_PARAMS_ID_MSB        0xFF
+#define SPI_FLASH_SFDP_BASIC_PARAMS_MAX_DWORDS    16
+#define SPI_FLASH_SFDP_HEADER_FIELD__NPH          16, 8 // number of parameter headers minus one (2nd DWORD)
+#define SPI_FLASH_SFDP_PARAM_HEADER_FIELD__ID_LSB 0, 8  // 1st DWORD
+#define SPI_FLASH_SFDP_PARAM_HEADER_FIELD__LENGTH 24, 8 // 1st DWORD, in DWORDs
+#define SPI_FLASH_SFDP_PARAM_HEADER_FIELD__PTR    0, 24 // 2nd DWORD
+#define SPI_FLASH_SFDP_PARAM_HEADER_FIELD__ID_MSB 24, 8 // 2nd DWORD
+#define SPI_FLASH_SFDP_DW1_FIELD__FAST_READ_1_1_2 16, 1
+#define SPI_FLASH_SFDP_DW1_FIELD__DTR             19, 1
+#define SPI_FLASH_SFDP_DW1_FIELD__FAST_READ_1_2_2 20, 1
+#define SPI_FLASH_SFDP_DW1_FIELD__FAST_READ_1_4_4 21, 1
+#define SPI_FLASH_SFDP_DW1_FIELD__FAST_READ_1_1_4 22, 1
+#define SPI_FLASH_SFDP_DW5_FIELD__FAST_READ_2_2_2 0, 1
+#define SPI_FLASH_SFDP_DW5_FIELD__FAST_READ_4_4_4 4, 1
+#define SPI_FLASH_SFDP_ERASE_FIELD__SIZE(type)    FIELD(((type) % 2) * 16, 8)     // DWORD 8 + type/2, 2^N bytes
+#define SPI_FLASH_SFDP_ERASE_FIELD__CMD(type)     FIELD(((type) % 2) * 16 + 8, 8) // DWORD 8 + type/2
+#define SPI_FLASH_SFDP_DW10_FIELD__ERASE_TIME(type) FIELD(4 + (type)*7, 7)        // count 4:0, units 6:5
+#define SPI_FLASH_SFDP_DW11_FIELD__PAGE_SIZE      4, 4  // 2^N bytes
+#define SPI_FLASH_SFDP_DW11_FIELD__PROGRAM_TIME   8, 6  // count 4:0, units 5 (8us/64us)
+#define SPI_FLASH_SFDP_DW11_FIELD__CHIP_ERASE_TIME 24, 7 // count 4:0, units 6:5 (16ms/256ms/4s/64s)
+#define SPI_FLASH_SFDP_TIME_FIELD__COUNT          0, 5
+#define SPI_FLASH_SFDP_TIME_FIELD__UNITS          5, 2
 #define SPI_FLASH__STATUS_1_FIELD__TB   5, 1 // TOP/BOTTOM PROTECT
 #define SPI_FLASH__STATUS_1_FIELD__SEC  6, 1 // SECTOR PROTECT
 #define SPI_FLASH__STATUS_1_FIELD__SRP  7, 1 // STATUS REGISTER PROTECT
@@ -27,12 +27,184 @@ static _INLINE_ QLIB_STATUS_T QLIB_TM__OP1_write_ibuf_L(QLIB_CONTEXT_T* qlibCont
 static _INLINE_ QLIB_STATUS_T QLIB_TM__OP2_read_obuf_L(QLIB_CONTEXT_T* qlibContext, U32* buf, U32 size);
 static QLIB_STATUS_T          QLIB_TM_GetStatus_L(QLIB_CONTEXT_T* qlibContext, STD_FLASH_STATUS_T* userStatus) __RAM_SECTION;
 static QLIB_STATUS_T          QLIB_TM_WriteEnable_L(QLIB_CONTEXT_T* qlibContext) __RAM_SECTION;
+static QLIB_STATUS_T          QLIB_TM_WriteEnableWait_L(QLIB_CONTEXT_T* qlibContext) __RAM_SECTION;
 static QLIB_STATUS_T          QLIB_TM_WaitWhileBusySec_L(QLIB_CONTEXT_T* qlibContext, QLIB_REG_SSR_T* ssr) __RAM_SECTION;
+static QLIB_STATUS_T          QLIB_TM_Acquire_L(QLIB_CONTEXT_T* qlibContext) __RAM_SECTION;
+static void                   QLIB_TM_Release_L(QLIB_CONTEXT_T* qlibContext) __RAM_SECTION;
+static QLIB_STATUS_T          QLIB_TM_SecureWritePhase_L(QLIB_CONTEXT_T* qlibContext,
+                                                         U32             ctag,
+                                                         const U32*      writeData,
+                                                         U32             writeDataSize,
+                                                         BOOL*           exitQpi) __RAM_SECTION;
+static QLIB_STATUS_T          QLIB_TM_SecureReadPhase_L(QLIB_CONTEXT_T* qlibContext,
+                                                        U32*            readData,
+                                                        U32             readDataSize,
+                                                        QLIB_REG_SSR_T* ssr,
+                                                        BOOL            enterQpi) __RAM_SECTION;
+#ifdef QLIB_SPI_ASYNC_ENABLED
+static QLIB_STATUS_T QLIB_TM_SecureReadPhaseStart_L(QLIB_CONTEXT_T* qlibContext, U32* readData, U32 readDataSize) __RAM_SECTION;
+#endif
+#ifdef QLIB_IRQ_OFF_STATS_SIZE
+static void QLIB_TM_IrqOffRecord_L(QLIB_CONTEXT_T* qlibContext, U8 cmd, BOOL secure, U32 irqOffUs) __RAM_SECTION;
+#endif
+#ifdef QLIB_SEC_READ_AHEAD_ENABLED
+static QLIB_STATUS_T          QLIB_TM_DropReadAhead_L(QLIB_CONTEXT_T* qlibContext) __RAM_SECTION;
+#endif
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+static QLIB_OP_TIME_ENTRY_T* QLIB_TM_OpTimeStart_L(QLIB_CONTEXT_T* qlibContext, U8 cmd, BOOL secure, U32 size, U32 startUs)
+    __RAM_SECTION;
+static void QLIB_TM_OpTimeEnd_L(QLIB_OP_TIME_ENTRY_T* entry, U32 startUs) __RAM_SECTION;
+static U32  QLIB_TM_OpTimePercentile_L(const QLIB_OP_TIME_ENTRY_T* entry, U32 percent);
+#ifdef QLIB_STD_SFDP_ENABLED
+static U32 QLIB_TM_SfdpTypicalUs_L(const QLIB_CONTEXT_T* qlibContext, U8 cmd, BOOL secure, U32 size) __RAM_SECTION;
+#endif
+#endif
+#ifdef QLIB_SPI_LIST_ENABLED
+static QLIB_STATUS_T QLIB_TM_SecureListWrite_L(QLIB_CONTEXT_T* qlibContext,
+                                               U32             ctag,
+                                               const U32*      writeData,
+                                               U32             writeDataSize,
+                                               BOOL*           exitQpi) __RAM_SECTION;
+static QLIB_STATUS_T QLIB_TM_SecureListPoll_L(QLIB_CONTEXT_T* qlibContext, U8 cmd, QLIB_REG_SSR_T* ssr) __RAM_SECTION;
+static QLIB_STATUS_T QLIB_TM_SecureListRead_L(QLIB_CONTEXT_T* qlibContext,
+                                              U32*            readData,
+                                              U32             readDataSize,
+                                              QLIB_REG_SSR_T* ssr,
+                                              BOOL            enterQpi) __RAM_SECTION;
+#endif
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+static QLIB_STATUS_T QLIB_TM_ContinuousReadExit_L(QLIB_CONTEXT_T* qlibContext) __RAM_SECTION;
+#endif
+#ifdef QLIB_SPI_DESC_ENABLED
+static const QLIB_SPI_DESC_SET_T* QLIB_TM_GetDescSet_L(QLIB_CONTEXT_T* qlibContext) __RAM_SECTION;
+static void                       QLIB_TM_BuildDesc_L(QLIB_CONTEXT_T*  qlibContext,
+                                                      QLIB_SPI_DESC_T* desc,
+                                                      QLIB_BUS_MODE_T  format,
+                                                      BOOL             dtr,
+                                                      U8               cmd,
+                                                      U8               dummyCycles);
+#endif
 
 #define SSR__RESP_READY_BIT MASK_FIELD(QLIB_REG_SSR__RESP_READY)
 #define SSR__BUSY_BIT       MASK_FIELD(QLIB_REG_SSR__BUSY)
 #define SSR__FLASH_BUSY_BIT MASK_FIELD(QLIB_REG_SSR__FLASH_BUSY)
 #define SSR__BUSY_BITS      (SSR__BUSY_BIT | SSR__FLASH_BUSY_BIT)
+
+/************************************************************************************************************
+ * Interrupts are masked around every SPI sequence which sends a command or reads its response: the QPI exit
+ * and enter, write enable, OP1, OP2 and the standard command, in the single transactions and in the
+ * transaction lists alike. The status polls and the busy waits are performed with interrupts enabled, also
+ * while QPI is exited for OP0, since a transaction started meanwhile is rejected by QLIB_TM_Acquire_L.
+ * In XIP the code is fetched from the flash, so interrupts are masked for the whole transaction.
+************************************************************************************************************/
+#ifdef QLIB_SUPPORT_XIP
+#define QLIB_TM_ATOMIC_START(context, ints) QLIB_TM_INTERRUPTS_DISABLE(context, ints)
+#define QLIB_TM_ATOMIC_END(context, ints)   QLIB_TM_INTERRUPTS_RESTORE(context, ints)
+#define QLIB_TM_CRITICAL_VAR_DECLARE(ints)
+#define QLIB_TM_CRITICAL_START(context, ints)
+#define QLIB_TM_CRITICAL_END(context, ints)
+#else
+#define QLIB_TM_ATOMIC_START(context, ints)
+#define QLIB_TM_ATOMIC_END(context, ints)
+#define QLIB_TM_CRITICAL_VAR_DECLARE(ints)    QLIB_TM_INTERRUPTS_VAR_DECLARE(ints)
+#define QLIB_TM_CRITICAL_START(context, ints) QLIB_TM_INTERRUPTS_DISABLE(context, ints)
+#define QLIB_TM_CRITICAL_END(context, ints)   QLIB_TM_INTERRUPTS_RESTORE(context, ints)
+#endif
+
+/************************************************************************************************************
+ * The longest interrupts masked window of each transaction is recorded per command type. The windows of the
+ * routines called by the transaction are accumulated in the context, from QLIB_TM_Acquire_L to the record.
+************************************************************************************************************/
+#ifdef QLIB_IRQ_OFF_STATS_SIZE
+#define QLIB_TM_INTERRUPTS_VAR_DECLARE(ints) \
+    INTERRUPTS_VAR_DECLARE(ints);            \
+    U32 irqOffStartUs = 0
+#define QLIB_TM_INTERRUPTS_DISABLE(context, ints) \
+    INTERRUPTS_SAVE_DISABLE(ints);                \
+    irqOffStartUs = PLAT_GetTimeUs()
+#define QLIB_TM_INTERRUPTS_RESTORE(context, ints)                        \
+    irqOffStartUs          = PLAT_GetTimeUs() - irqOffStartUs;           \
+    (context)->irqOffMaxUs = MAX((context)->irqOffMaxUs, irqOffStartUs); \
+    INTERRUPTS_RESTORE(ints)
+#define QLIB_TM_IRQ_OFF_RECORD(context, cmd, secure) QLIB_TM_IrqOffRecord_L(context, cmd, secure, (context)->irqOffMaxUs)
+#else
+#define QLIB_TM_INTERRUPTS_VAR_DECLARE(ints)      INTERRUPTS_VAR_DECLARE(ints)
+#define QLIB_TM_INTERRUPTS_DISABLE(context, ints) INTERRUPTS_SAVE_DISABLE(ints)
+#define QLIB_TM_INTERRUPTS_RESTORE(context, ints) INTERRUPTS_RESTORE(ints)
+#define QLIB_TM_IRQ_OFF_RECORD(context, cmd, secure)
+#endif
+
+/************************************************************************************************************
+ * The capture time of the SSR cached in QLIB context is recorded, so notifications can be served from it
+************************************************************************************************************/
+#ifdef QLIB_NOTIF_SSR_MAX_AGE_US
+#define QLIB_TM_SSR_CAPTURED(context, ssrP)            \
+    do                                                 \
+    {                                                  \
+        if ((ssrP) == &(context)->ssr)                 \
+        {                                              \
+            (context)->ssrTimeUs   = PLAT_GetTimeUs(); \
+            (context)->ssrCaptured = TRUE;             \
+        }                                              \
+    } while (0)
+#else
+#define QLIB_TM_SSR_CAPTURED(context, ssrP)
+#endif
+
+/************************************************************************************************************
+ * Secure commands which completion time is learned by the operation time model
+************************************************************************************************************/
+#define QLIB_TM_OP_TIME_IS_MODELED_SEC(cmd)                                                                   \
+    (QLIB_CMD_SEC_SAWR == (cmd) || (QLIB_CMD_SEC_SERASE_4 <= (cmd) && QLIB_CMD_SEC_SERASE_ALL >= (cmd)) || \
+     QLIB_CMD_SEC_ERASE_SECT_PA == (cmd) || QLIB_CMD_SEC_CALC_SIG == (cmd))
+
+/************************************************************************************************************
+ * Standard commands which completion time is learned by the operation time model
+************************************************************************************************************/
+#define QLIB_TM_OP_TIME_IS_MODELED_STD(cmd)                                                \
+    (SPI_FLASH_CMD__PAGE_PROGRAM == (cmd) || SPI_FLASH_CMD__PAGE_PROGRAM_1_1_4 == (cmd) || \
+     SPI_FLASH_CMD__ERASE_SECTOR == (cmd) || SPI_FLASH_CMD__ERASE_BLOCK_32 == (cmd) ||     \
+     SPI_FLASH_CMD__ERASE_BLOCK_64 == (cmd) || SPI_FLASH_CMD__ERASE_CHIP == (cmd) ||       \
+     SPI_FLASH_CMD__ERASE_CHIP_DEPRECATED == (cmd))
+
+#ifdef QLIB_SPI_LIST_ENABLED
+/************************************************************************************************************
+ * SPI transaction lists of a secure command: exit QPI and OP1, two OP0 polls, enter QPI and the OP2 reads
+************************************************************************************************************/
+#ifdef QLIB_MAX_SPI_INPUT_SIZE
+#define QLIB_TM_SPI_LIST_OP2_CHUNK ROUND_DOWN(QLIB_MAX_SPI_INPUT_SIZE, 4)
+#define QLIB_TM_SPI_LIST_OP2_ITEMS 4
+#else
+#define QLIB_TM_SPI_LIST_OP2_CHUNK MAX_U32
+#define QLIB_TM_SPI_LIST_OP2_ITEMS 1
+#endif
+#define QLIB_TM_SPI_LIST_WRITE_SIZE 2
+#define QLIB_TM_SPI_LIST_POLL_SIZE  2
+#define QLIB_TM_SPI_LIST_READ_SIZE  (1 + QLIB_TM_SPI_LIST_OP2_ITEMS)
+
+/************************************************************************************************************
+ * Secure commands which can be submitted as transaction lists. CALC_SIG polls until its response is ready
+ * and the modeled commands wait for their predicted completion before polling.
+************************************************************************************************************/
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+#define QLIB_TM_SPI_LIST_IS_SUPPORTED_SEC(cmd, readDataSize)                                                  \
+    (QLIB_CMD_SEC_CALC_SIG != (cmd) && !QLIB_TM_OP_TIME_IS_MODELED_SEC(cmd) &&                                \
+     (readDataSize) <= QLIB_TM_SPI_LIST_OP2_CHUNK * QLIB_TM_SPI_LIST_OP2_ITEMS)
+#else
+#define QLIB_TM_SPI_LIST_IS_SUPPORTED_SEC(cmd, readDataSize) \
+    (QLIB_CMD_SEC_CALC_SIG != (cmd) && (readDataSize) <= QLIB_TM_SPI_LIST_OP2_CHUNK * QLIB_TM_SPI_LIST_OP2_ITEMS)
+#endif
+#endif // QLIB_SPI_LIST_ENABLED
+
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+/************************************************************************************************************
+ * Continuous read mode bits (M7-0), sent after the address of the 1-2-2 and 1-4-4 fast reads.
+ * M5-4 = (1,0) keeps the flash in continuous read mode, any other value exits it at the end of the read.
+************************************************************************************************************/
+#define QLIB_TM_CONTINUOUS_READ_MODE_ENTER      0x20
+#define QLIB_TM_CONTINUOUS_READ_MODE_EXIT       0xFF
+#define QLIB_TM_CONTINUOUS_READ_MODE_CYCLES(fmt) ((QLIB_BUS_MODE_1_4_4 == (fmt)) ? 2 : 4)
+#endif
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                           INTERFACE FUNCTIONS                                           */
@@ -45,6 +217,14 @@ QLIB_STATUS_T QLIB_TM_Init(QLIB_CONTEXT_T* qlibContext)
     qlibContext->busInterface.busMode          = QLIB_BUS_MODE_INVALID;
     qlibContext->busInterface.secureCmdsFormat = QLIB_BUS_MODE_INVALID;
     qlibContext->busInterface.busIsLocked      = FALSE;
+#ifdef QLIB_SPI_DESC_ENABLED
+    memset(qlibContext->spiDesc, 0, sizeof(qlibContext->spiDesc));
+    qlibContext->spiDescLast = 0;
+#endif
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+    qlibContext->continuousReadEnabled = FALSE;
+    qlibContext->continuousReadCmd     = SPI_FLASH_CMD__NONE;
+#endif
 
     return QLIB_STATUS__OK;
 }
@@ -77,6 +257,36 @@ QLIB_STATUS_T QLIB_TM_Disconnect(QLIB_CONTEXT_T* qlibContext)
     QLIB_INTERFACE_T* busInterface = &qlibContext->busInterface;
     INTERRUPTS_VAR_DECLARE(ints);
 
+#ifdef QLIB_SPI_ASYNC_ENABLED
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Complete asynchronous transaction before releasing the bus                                          */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (TRUE == busInterface->busIsLocked)
+    {
+        QLIB_STATUS_RET_CHECK(QLIB_TM_Secure_ReadWait(qlibContext));
+    }
+#endif // QLIB_SPI_ASYNC_ENABLED
+
+#ifdef QLIB_SEC_READ_AHEAD_ENABLED
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Leave the flash ready before releasing the bus                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (TRUE == busInterface->busIsLocked)
+    {
+        QLIB_STATUS_RET_CHECK(QLIB_TM_DropReadAhead_L(qlibContext));
+    }
+#endif // QLIB_SEC_READ_AHEAD_ENABLED
+
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Leave continuous read mode before releasing the bus                                                 */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (TRUE == busInterface->busIsLocked)
+    {
+        QLIB_STATUS_RET_CHECK(QLIB_TM_ContinuousReadExit_L(qlibContext));
+    }
+#endif // QLIB_STD_CONTINUOUS_READ_ENABLED
+
     INTERRUPTS_SAVE_DISABLE(ints);
 
     if (FALSE == busInterface->busIsLocked)
@@ -111,7 +321,11 @@ QLIB_STATUS_T QLIB_TM_Standard(QLIB_CONTEXT_T*   qlibContext,
     U32             addrSize = 0;
     QLIB_BUS_MODE_T mode     = QLIB_BUS_FORMAT_GET_MODE(busFormat);
     BOOL            dtr      = QLIB_BUS_FORMAT_GET_DTR(busFormat);
-    INTERRUPTS_VAR_DECLARE(ints);
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+    QLIB_OP_TIME_ENTRY_T* opTime      = NULL;
+    U32                   opTimeStart = 0;
+#endif
+    QLIB_TM_INTERRUPTS_VAR_DECLARE(ints);
 
     /*-----------------------------------------------------------------------------------------------------*/
     /* Error checking                                                                                      */
@@ -121,6 +335,23 @@ QLIB_STATUS_T QLIB_TM_Standard(QLIB_CONTEXT_T*   qlibContext,
         return QLIB_STATUS__NOT_CONNECTED;
     }
 
+    QLIB_STATUS_RET_CHECK(QLIB_TM_Acquire_L(qlibContext));
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Start atomic transaction                                                                            */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_TM_ATOMIC_START(qlibContext, ints);
+
+#ifdef QLIB_SPI_ASYNC_ENABLED
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_Secure_ReadWait(qlibContext), ret, exit);
+#endif
+#ifdef QLIB_SEC_READ_AHEAD_ENABLED
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_DropReadAhead_L(qlibContext), ret, exit);
+#endif
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_ContinuousReadExit_L(qlibContext), ret, exit);
+#endif
+
     /*-----------------------------------------------------------------------------------------------------*/
     /* Handle address                                                                                      */
     /*-----------------------------------------------------------------------------------------------------*/
@@ -137,43 +368,61 @@ QLIB_STATUS_T QLIB_TM_Standard(QLIB_CONTEXT_T*   qlibContext,
     }
 
     /*-----------------------------------------------------------------------------------------------------*/
-    /* Start atomic transaction                                                                            */
-    /*-----------------------------------------------------------------------------------------------------*/
-    INTERRUPTS_SAVE_DISABLE(ints);
-
-    /*-----------------------------------------------------------------------------------------------------*/
-    /* Perform write enable if needed                                                                      */
+    /* Perform write enable if needed without interruptions, and wait for it with interrupts enabled       */
     /*-----------------------------------------------------------------------------------------------------*/
     if (TRUE == needWriteEnable)
     {
-        QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_WriteEnable_L(qlibContext), ret, exit);
+        QLIB_TM_CRITICAL_START(qlibContext, ints);
+        ret = QLIB_TM_WriteEnable_L(qlibContext);
+        QLIB_TM_CRITICAL_END(qlibContext, ints);
+
+        if (QLIB_STATUS__OK != ret)
+        {
+            goto exit;
+        }
+
+        QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_WriteEnableWait_L(qlibContext), ret, exit);
     }
 
     /*-----------------------------------------------------------------------------------------------------*/
-    /* Perform transaction                                                                                 */
+    /* Perform the transaction without interruptions                                                       */
     /*-----------------------------------------------------------------------------------------------------*/
     if (cmd != SPI_FLASH_CMD__NONE)
     {
-        QLIB_STATUS_RET_CHECK_GOTO(PLAT_SPI_WriteReadTransaction(qlibContext->userData,
-                                                                 mode,
-                                                                 dtr,
-                                                                 cmd,
-                                                                 addr,
-                                                                 addrSize,
-                                                                 writeData,
-                                                                 writeDataSize,
-                                                                 dummyCycles,
-                                                                 readData,
-                                                                 readDataSize),
-                                   ret,
-                                   exit);
+        QLIB_TM_CRITICAL_START(qlibContext, ints);
+        ret = PLAT_SPI_WriteReadTransaction(qlibContext->userData,
+                                            mode,
+                                            dtr,
+                                            cmd,
+                                            addr,
+                                            addrSize,
+                                            writeData,
+                                            writeDataSize,
+                                            dummyCycles,
+                                            readData,
+                                            readDataSize);
+        QLIB_TM_CRITICAL_END(qlibContext, ints);
+
+        if (QLIB_STATUS__OK != ret)
+        {
+            goto exit;
+        }
     }
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+    opTimeStart = PLAT_GetTimeUs();
+#endif
 
     /*-----------------------------------------------------------------------------------------------------*/
     /* Perform wait while busy                                                                             */
     /*-----------------------------------------------------------------------------------------------------*/
     if (TRUE == waitWhileBusy || NULL != ssr)
     {
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+        if (TRUE == waitWhileBusy && QLIB_TM_OP_TIME_IS_MODELED_STD(cmd))
+        {
+            opTime = QLIB_TM_OpTimeStart_L(qlibContext, cmd, FALSE, writeDataSize, opTimeStart);
+        }
+#endif
         QLIB_ACTION_BY_FLASH_TYPE(
             qlibContext,
             { QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_WaitWhileBusySec_L(qlibContext, ssr), ret, exit); },
@@ -181,16 +430,129 @@ QLIB_STATUS_T QLIB_TM_Standard(QLIB_CONTEXT_T*   qlibContext,
                 QLIB_ASSERT_WITH_ERROR_GOTO(ssr == NULL, QLIB_STATUS__INVALID_PARAMETER, ret, exit);
                 QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_WaitWhileBusyStd_L(qlibContext), ret, exit);
             });
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+        if (NULL != opTime)
+        {
+            QLIB_TM_OpTimeEnd_L(opTime, opTimeStart);
+        }
+#endif
     }
 
 exit:
     /*-----------------------------------------------------------------------------------------------------*/
     /* End atomic transaction                                                                              */
     /*-----------------------------------------------------------------------------------------------------*/
-    INTERRUPTS_RESTORE(ints);
+    QLIB_TM_ATOMIC_END(qlibContext, ints);
+    QLIB_TM_IRQ_OFF_RECORD(qlibContext, cmd, FALSE);
+    QLIB_TM_Release_L(qlibContext);
+
+    return ret;
+}
+
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+QLIB_STATUS_T QLIB_TM_StandardContinuousRead(QLIB_CONTEXT_T*   qlibContext,
+                                             QLIB_BUS_FORMAT_T busFormat,
+                                             U8                cmd,
+                                             U32               address,
+                                             U32               dummyCycles,
+                                             U8*               readData,
+                                             U32               readDataSize)
+{
+    QLIB_STATUS_T   ret  = QLIB_STATUS__OK;
+    QLIB_BUS_MODE_T mode = QLIB_BUS_FORMAT_GET_MODE(busFormat);
+    U32             modeAddress;
+    U32             modeDummyCycles;
+    QLIB_TM_INTERRUPTS_VAR_DECLARE(ints);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (FALSE == qlibContext->busInterface.busIsLocked)
+    {
+        return QLIB_STATUS__NOT_CONNECTED;
+    }
+
+    QLIB_ASSERT_RET((QLIB_BUS_MODE_1_4_4 == mode || QLIB_BUS_MODE_1_2_2 == mode) &&
+                        FALSE == QLIB_BUS_FORMAT_GET_DTR(busFormat) &&
+                        QLIB_TM_CONTINUOUS_READ_MODE_CYCLES(mode) <= dummyCycles,
+                    QLIB_STATUS__INVALID_PARAMETER);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* The mode bits follow the address and take the first dummy cycles                                    */
+    /*-----------------------------------------------------------------------------------------------------*/
+    modeAddress     = (address << 8) | QLIB_TM_CONTINUOUS_READ_MODE_ENTER;
+    modeDummyCycles = dummyCycles - QLIB_TM_CONTINUOUS_READ_MODE_CYCLES(mode);
+
+    QLIB_STATUS_RET_CHECK(QLIB_TM_Acquire_L(qlibContext));
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Start atomic transaction                                                                            */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_TM_ATOMIC_START(qlibContext, ints);
+
+#ifdef QLIB_SPI_ASYNC_ENABLED
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_Secure_ReadWait(qlibContext), ret, exit);
+#endif
+#ifdef QLIB_SEC_READ_AHEAD_ENABLED
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_DropReadAhead_L(qlibContext), ret, exit);
+#endif
+    if (cmd != qlibContext->continuousReadCmd)
+    {
+        QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_ContinuousReadExit_L(qlibContext), ret, exit);
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Perform the read without interruptions                                                              */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_TM_CRITICAL_START(qlibContext, ints);
+    if (cmd == qlibContext->continuousReadCmd)
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* The flash is in continuous read mode, skip the instruction                                      */
+        /*-------------------------------------------------------------------------------------------------*/
+        ret = PLAT_SPI_ContinuousReadTransaction(qlibContext->userData,
+                                                 mode,
+                                                 FALSE,
+                                                 modeAddress,
+                                                 4,
+                                                 modeDummyCycles,
+                                                 readData,
+                                                 readDataSize);
+    }
+    else
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Send the instruction and enter continuous read mode                                             */
+        /*-------------------------------------------------------------------------------------------------*/
+        ret = PLAT_SPI_WriteReadTransaction(qlibContext->userData,
+                                            mode,
+                                            FALSE,
+                                            cmd,
+                                            modeAddress,
+                                            4,
+                                            NULL,
+                                            0,
+                                            modeDummyCycles,
+                                            readData,
+                                            readDataSize);
+        if (QLIB_STATUS__OK == ret)
+        {
+            qlibContext->continuousReadCmd = cmd;
+        }
+    }
+    QLIB_TM_CRITICAL_END(qlibContext, ints);
+
+exit:
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* End atomic transaction                                                                              */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_TM_ATOMIC_END(qlibContext, ints);
+    QLIB_TM_IRQ_OFF_RECORD(qlibContext, cmd, FALSE);
+    QLIB_TM_Release_L(qlibContext);
 
     return ret;
 }
+#endif // QLIB_STD_CONTINUOUS_READ_ENABLED
 
 QLIB_STATUS_T QLIB_TM_Secure(QLIB_CONTEXT_T* qlibContext,
                              U32             ctag,
@@ -200,58 +562,91 @@ QLIB_STATUS_T QLIB_TM_Secure(QLIB_CONTEXT_T* qlibContext,
                              U32             readDataSize,
                              QLIB_REG_SSR_T* ssr)
 {
-    QLIB_STATUS_T     ret          = QLIB_STATUS__OK;
-    QLIB_INTERFACE_T* busInterface = &qlibContext->busInterface;
-#ifdef QLIB_SUPPORT_QPI
-    BOOL exitQpi = FALSE;
-#endif // QLIB_SUPPORT_QPI
-    INTERRUPTS_VAR_DECLARE(ints);
+    QLIB_STATUS_T ret     = QLIB_STATUS__OK;
+    U8            cmd     = QLIB_CMD_PROC__CTAG_GET_CMD(ctag);
+    BOOL          exitQpi = FALSE;
+#ifdef QLIB_PLAT_WAIT_ENABLED
+    U32 pollCount = 0;
+#endif
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+    QLIB_OP_TIME_ENTRY_T* opTime      = NULL;
+    U32                   opTimeStart = 0;
+#endif
+    QLIB_TM_INTERRUPTS_VAR_DECLARE(ints);
 
     /*-----------------------------------------------------------------------------------------------------*/
     /* Error checking                                                                                      */
     /*-----------------------------------------------------------------------------------------------------*/
-    if (FALSE == busInterface->busIsLocked)
+    if (FALSE == qlibContext->busInterface.busIsLocked)
     {
         return QLIB_STATUS__NOT_CONNECTED;
     }
 
+    QLIB_STATUS_RET_CHECK(QLIB_TM_Acquire_L(qlibContext));
+
     /*-----------------------------------------------------------------------------------------------------*/
     /* Start atomic transaction                                                                            */
     /*-----------------------------------------------------------------------------------------------------*/
-    INTERRUPTS_SAVE_DISABLE(ints);
+    QLIB_TM_ATOMIC_START(qlibContext, ints);
+
+#ifdef QLIB_SPI_ASYNC_ENABLED
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_Secure_ReadWait(qlibContext), ret, exit);
+#endif
+#ifdef QLIB_SEC_READ_AHEAD_ENABLED
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_DropReadAhead_L(qlibContext), ret, exit);
+#endif
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_ContinuousReadExit_L(qlibContext), ret, exit);
+#endif
 
+#ifdef QLIB_SPI_LIST_ENABLED
     /*-----------------------------------------------------------------------------------------------------*/
-    /* Perform write phase                                                                                 */
+    /* Submit the command to the platform as transaction lists, masked like the single transactions below   */
     /*-----------------------------------------------------------------------------------------------------*/
-    if (ctag != 0)
+    if (ctag != 0 && ssr != NULL && QLIB_TM_SPI_LIST_IS_SUPPORTED_SEC(cmd, readDataSize))
     {
-#ifdef QLIB_SUPPORT_QPI
-        /*-------------------------------------------------------------------------------------------------*/
-        /* OP1 doesn't support QPI, exit for op1                                                           */
-        /*-------------------------------------------------------------------------------------------------*/
-        if (QLIB_BUS_MODE_4_4_4 == busInterface->secureCmdsFormat)
-        {
-            exitQpi = TRUE;
-            QLIB_STATUS_RET_CHECK_GOTO(PLAT_SPI_WriteReadTransaction(qlibContext->userData,
-                                                                     QLIB_BUS_MODE_4_4_4,
-                                                                     FALSE,
-                                                                     SPI_FLASH_CMD__EXIT_QPI,
-                                                                     0,
-                                                                     0,
-                                                                     NULL,
-                                                                     0,
-                                                                     0,
-                                                                     NULL,
-                                                                     0),
-                                       ret,
-                                       exit);
-
-            // After exit QPI temporarily set the format to quad so the follow transactions execute in quad
-            busInterface->secureCmdsFormat = QLIB_BUS_MODE_1_1_4;
+        QLIB_TM_CRITICAL_START(qlibContext, ints);
+        ret = QLIB_TM_SecureListWrite_L(qlibContext, ctag, writeData, writeDataSize, &exitQpi);
+        QLIB_TM_CRITICAL_END(qlibContext, ints);
+
+        if (QLIB_STATUS__OK != ret)
+        {
+            goto exit;
         }
-#endif // QLIB_SUPPORT_QPI
 
-        QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM__OP1_write_ibuf_L(qlibContext, ctag, writeData, writeDataSize), ret, exit);
+        QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_SecureListPoll_L(qlibContext, cmd, ssr), ret, exit);
+
+        if (TRUE == exitQpi || 0 != readDataSize)
+        {
+            QLIB_TM_CRITICAL_START(qlibContext, ints);
+            ret = QLIB_TM_SecureListRead_L(qlibContext, readData, readDataSize, ssr, exitQpi);
+            QLIB_TM_CRITICAL_END(qlibContext, ints);
+
+            if (QLIB_STATUS__OK != ret)
+            {
+                goto exit;
+            }
+        }
+        goto postCommand;
+    }
+#endif
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Perform write phase without interruptions                                                           */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (ctag != 0)
+    {
+        QLIB_TM_CRITICAL_START(qlibContext, ints);
+        ret = QLIB_TM_SecureWritePhase_L(qlibContext, ctag, writeData, writeDataSize, &exitQpi);
+        QLIB_TM_CRITICAL_END(qlibContext, ints);
+
+        if (QLIB_STATUS__OK != ret)
+        {
+            goto exit;
+        }
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+        opTimeStart = PLAT_GetTimeUs();
+#endif
     }
 
     /*-----------------------------------------------------------------------------------------------------*/
@@ -259,79 +654,59 @@ QLIB_STATUS_T QLIB_TM_Secure(QLIB_CONTEXT_T* qlibContext,
     /*-----------------------------------------------------------------------------------------------------*/
     if (ssr != NULL)
     {
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+        if (QLIB_TM_OP_TIME_IS_MODELED_SEC(cmd))
+        {
+            opTime = QLIB_TM_OpTimeStart_L(qlibContext, cmd, TRUE, 0, opTimeStart);
+        }
+#endif
         QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_WaitWhileBusySec_L(qlibContext, ssr), ret, exit);
-        if (QLIB_CMD_PROC__CTAG_GET_CMD(ctag) == QLIB_CMD_SEC_SAWR)
+        if (cmd == QLIB_CMD_SEC_SAWR)
         {
             QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_WaitWhileBusySec_L(qlibContext, ssr), ret, exit);
         }
-        if (QLIB_CMD_PROC__CTAG_GET_CMD(ctag) == QLIB_CMD_SEC_CALC_SIG)
+        if (cmd == QLIB_CMD_SEC_CALC_SIG)
         {
             QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_WaitWhileBusySec_L(qlibContext, ssr), ret, exit);
-        }
-    }
-
-#ifdef QLIB_SUPPORT_QPI
-    if (exitQpi == TRUE)
-    {
-        QLIB_STATUS_RET_CHECK_GOTO(PLAT_SPI_WriteReadTransaction(qlibContext->userData,
-                                                                 QLIB_BUS_MODE_1_1_1,
-                                                                 FALSE,
-                                                                 SPI_FLASH_CMD__ENTER_QPI,
-                                                                 0,
-                                                                 0,
-                                                                 NULL,
-                                                                 0,
-                                                                 0,
-                                                                 NULL,
-                                                                 0),
-                                   ret,
-                                   exit);
 
-        // After entering back to QPI set the format back to quad
-        busInterface->secureCmdsFormat = QLIB_BUS_MODE_4_4_4;
+            /*---------------------------------------------------------------------------------------------*/
+            /* Poll until the signature is ready, with interrupts enabled                                  */
+            /*---------------------------------------------------------------------------------------------*/
+            while (0 != readDataSize && 0 == READ_VAR_FIELD(ssr->asUint, QLIB_REG_SSR__ERR) &&
+                   0 == READ_VAR_FIELD(ssr->asUint, QLIB_REG_SSR__RESP_READY))
+            {
+#ifdef QLIB_PLAT_WAIT_ENABLED
+                QLIB_STATUS_RET_CHECK_GOTO(PLAT_SPI_WaitWhileBusy(qlibContext->userData, pollCount++), ret, exit);
+#endif
+                QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_WaitWhileBusySec_L(qlibContext, ssr), ret, exit);
+            }
+        }
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+        if (NULL != opTime)
+        {
+            QLIB_TM_OpTimeEnd_L(opTime, opTimeStart);
+        }
+#endif
     }
-#endif // QLIB_SUPPORT_QPI
 
     /*-----------------------------------------------------------------------------------------------------*/
-    /* Perform read phase if needed                                                                        */
+    /* Perform read phase if needed without interruptions                                                  */
     /*-----------------------------------------------------------------------------------------------------*/
-    if (0 != readDataSize)
+    if (TRUE == exitQpi || 0 != readDataSize)
     {
-        if ((ssr != NULL) &&
-            (0 == READ_VAR_FIELD(ssr->asUint, QLIB_REG_SSR__RESP_READY))
-        )
-        {
-            if (QLIB_CMD_PROC__CTAG_GET_CMD(ctag) == QLIB_CMD_SEC_CALC_SIG)
-            {
-                QLIB_REG_SSR_T tempSSR = *ssr;
+        QLIB_TM_CRITICAL_START(qlibContext, ints);
+        ret = QLIB_TM_SecureReadPhase_L(qlibContext, readData, readDataSize, ssr, exitQpi);
+        QLIB_TM_CRITICAL_END(qlibContext, ints);
 
-                while ((READ_VAR_FIELD(tempSSR.asUint, QLIB_REG_SSR__ERR) == 0) &&
-                       (READ_VAR_FIELD(tempSSR.asUint, QLIB_REG_SSR__RESP_READY) == 0))
-
-                {
-                    QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM__OP0_get_ssr_L(qlibContext, &tempSSR), ret, exit);
-                }
-
-                SET_VAR_FIELD(ssr->asUint, QLIB_REG_SSR__RESP_READY, READ_VAR_FIELD(tempSSR.asUint, QLIB_REG_SSR__RESP_READY));
-                SET_VAR_FIELD(ssr->asUint, QLIB_REG_SSR__ERR, READ_VAR_FIELD(tempSSR.asUint, QLIB_REG_SSR__ERR));
-
-                if (READ_VAR_FIELD(ssr->asUint, QLIB_REG_SSR__ERR) == 1)
-                {
-                    goto exit;
-                }
-            }
-            else
-            {
-                /*-----------------------------------------------------------------------------------------*/
-                /* Emulate HW error                                                                        */
-                /*-----------------------------------------------------------------------------------------*/
-                SET_VAR_FIELD(ssr->asUint, QLIB_REG_SSR__ERR, 1);
-                goto exit;
-            }
+        if (QLIB_STATUS__OK != ret)
+        {
+            goto exit;
         }
-        QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM__OP2_read_obuf_L(qlibContext, readData, readDataSize), ret, exit);
     }
 
+#ifdef QLIB_SPI_LIST_ENABLED
+postCommand:
+#endif
     if (qlibContext->multiTransactionCmd == FALSE) //if TRUE this comes from Read/Write commands
     {
         /*-------------------------------------------------------------------------------------------------*/
@@ -348,7 +723,14 @@ QLIB_STATUS_T QLIB_TM_Secure(QLIB_CONTEXT_T* qlibContext,
             {
                 ctag = MAKE_32_BIT(QLIB_CMD_SEC_INIT_SECTION_PA, BYTE(ctag, 1), 0, 0);
 
-                QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM__OP1_write_ibuf_L(qlibContext, ctag, writeData, writeDataSize), ret, exit);
+                QLIB_TM_CRITICAL_START(qlibContext, ints);
+                ret = QLIB_TM__OP1_write_ibuf_L(qlibContext, ctag, writeData, writeDataSize);
+                QLIB_TM_CRITICAL_END(qlibContext, ints);
+
+                if (QLIB_STATUS__OK != ret)
+                {
+                    goto exit;
+                }
 
                 QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_WaitWhileBusySec_L(qlibContext, ssr), ret, exit);
             }
@@ -368,35 +750,164 @@ exit:
     /*-----------------------------------------------------------------------------------------------------*/
     /* End atomic transaction                                                                              */
     /*-----------------------------------------------------------------------------------------------------*/
-    INTERRUPTS_RESTORE(ints);
+    QLIB_TM_ATOMIC_END(qlibContext, ints);
+    QLIB_TM_IRQ_OFF_RECORD(qlibContext, cmd, TRUE);
+    QLIB_TM_Release_L(qlibContext);
 
     return ret;
 }
 
-/*---------------------------------------------------------------------------------------------------------*/
-/*---------------------------------------------------------------------------------------------------------*/
-/*                                             LOCAL FUNCTIONS                                             */
-/*---------------------------------------------------------------------------------------------------------*/
-/*---------------------------------------------------------------------------------------------------------*/
-
-/************************************************************************************************************
- * @brief       This routine retrieve SSR (Secure Status Register)
- *
- * @param[in]   qlibContext    Context
- * @param[out]  ssr            SSR (Secure Status Register) value (32bit)
- *
- * @return      QLIB_STATUS__OK if no error occurred, QLIB_STATUS__(ERROR) otherwise
-************************************************************************************************************/
-static _INLINE_ QLIB_STATUS_T QLIB_TM__OP0_get_ssr_L(QLIB_CONTEXT_T* qlibContext, QLIB_REG_SSR_T* ssr)
+#ifdef QLIB_SPI_ASYNC_ENABLED
+QLIB_STATUS_T QLIB_TM_Secure_ReadStart(QLIB_CONTEXT_T* qlibContext, U32* readData, U32 readDataSize, QLIB_REG_SSR_T* ssr)
 {
-    QLIB_BUS_MODE_T format = qlibContext->busInterface.secureCmdsFormat;
-    U8              op0    = qlibContext->busInterface.op0;
-    BOOL            dtr    = qlibContext->busInterface.dtr;
+    QLIB_STATUS_T ret = QLIB_STATUS__OK;
+    QLIB_TM_INTERRUPTS_VAR_DECLARE(ints);
 
     /*-----------------------------------------------------------------------------------------------------*/
-    /* Perform GET_SSR command                                                                             */
+    /* Error checking                                                                                      */
     /*-----------------------------------------------------------------------------------------------------*/
-    QLIB_STATUS_RET_CHECK(PLAT_SPI_WriteReadTransaction(qlibContext->userData,
+    if (FALSE == qlibContext->busInterface.busIsLocked)
+    {
+        return QLIB_STATUS__NOT_CONNECTED;
+    }
+
+    QLIB_ASSERT_RET(NULL != ssr, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_STATUS_RET_CHECK(QLIB_TM_Acquire_L(qlibContext));
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Start atomic transaction                                                                            */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_TM_ATOMIC_START(qlibContext, ints);
+
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_Secure_ReadWait(qlibContext), ret, exit);
+#ifdef QLIB_SEC_READ_AHEAD_ENABLED
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_DropReadAhead_L(qlibContext), ret, exit);
+#endif
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_ContinuousReadExit_L(qlibContext), ret, exit);
+#endif
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Wait while busy                                                                                     */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK_GOTO(QLIB_TM_WaitWhileBusySec_L(qlibContext, ssr), ret, exit);
+
+    if (0 == READ_VAR_FIELD(ssr->asUint, QLIB_REG_SSR__RESP_READY))
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Emulate HW error                                                                                */
+        /*-------------------------------------------------------------------------------------------------*/
+        SET_VAR_FIELD(ssr->asUint, QLIB_REG_SSR__ERR, 1);
+        goto exit;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Start read phase without interruptions, completed by QLIB_TM_Secure_ReadWait                        */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_TM_CRITICAL_START(qlibContext, ints);
+    ret = QLIB_TM_SecureReadPhaseStart_L(qlibContext, readData, readDataSize);
+    QLIB_TM_CRITICAL_END(qlibContext, ints);
+
+exit:
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* End atomic transaction                                                                              */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_TM_ATOMIC_END(qlibContext, ints);
+    QLIB_TM_IRQ_OFF_RECORD(qlibContext, QLIB_CMD_SEC_NONE, TRUE);
+    QLIB_TM_Release_L(qlibContext);
+
+    return ret;
+}
+
+QLIB_STATUS_T QLIB_TM_Secure_ReadWait(QLIB_CONTEXT_T* qlibContext)
+{
+    if (0 == qlibContext->spiAsyncPending)
+    {
+        return QLIB_STATUS__OK;
+    }
+
+    qlibContext->spiAsyncPending = 0;
+
+    return PLAT_SPI_WriteReadTransaction_Async_Wait(qlibContext->userData);
+}
+#endif // QLIB_SPI_ASYNC_ENABLED
+
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+void QLIB_TM_OpTimeGetStats(QLIB_CONTEXT_T* qlibContext, QLIB_OP_TIME_STATS_T* stats, U32 maxEntries, U32* numEntries)
+{
+    const QLIB_OP_TIME_ENTRY_T* entry;
+    U32                         i;
+    U32                         count = 0;
+
+    for (i = 0; i < QLIB_OP_TIME_MODEL_SIZE; i++)
+    {
+        entry = &qlibContext->opTimeModel.entries[i];
+        if (0 == entry->count)
+        {
+            continue;
+        }
+
+        if (count < maxEntries)
+        {
+            stats[count].count  = entry->count;
+            stats[count].avgUs  = entry->ewma >> QLIB_OP_TIME_EWMA_SHIFT;
+            stats[count].minUs  = entry->minUs;
+            stats[count].maxUs  = entry->maxUs;
+            stats[count].p50Us  = QLIB_TM_OpTimePercentile_L(entry, 50);
+            stats[count].p90Us  = QLIB_TM_OpTimePercentile_L(entry, 90);
+            stats[count].p99Us  = QLIB_TM_OpTimePercentile_L(entry, 99);
+            stats[count].size   = entry->size;
+            stats[count].cmd    = entry->cmd;
+            stats[count].secure = entry->secure;
+        }
+        count++;
+    }
+
+    *numEntries = count;
+}
+
+void QLIB_TM_OpTimeReset(QLIB_CONTEXT_T* qlibContext)
+{
+    memset(&qlibContext->opTimeModel, 0, sizeof(qlibContext->opTimeModel));
+}
+#endif // QLIB_OP_TIME_MODEL_SIZE
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                             LOCAL FUNCTIONS                                             */
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+
+/************************************************************************************************************
+ * @brief       This routine retrieve SSR (Secure Status Register)
+ *
+ * @param[in]   qlibContext    Context
+ * @param[out]  ssr            SSR (Secure Status Register) value (32bit)
+ *
+ * @return      QLIB_STATUS__OK if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static _INLINE_ QLIB_STATUS_T QLIB_TM__OP0_get_ssr_L(QLIB_CONTEXT_T* qlibContext, QLIB_REG_SSR_T* ssr)
+{
+#ifdef QLIB_SPI_DESC_ENABLED
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Perform GET_SSR command                                                                             */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(PLAT_SPI_DescTransaction(qlibContext->userData,
+                                                   &QLIB_TM_GetDescSet_L(qlibContext)->desc[QLIB_SPI_DESC__OP0],
+                                                   0,
+                                                   NULL,
+                                                   0,
+                                                   (U8*)&(ssr->asUint),
+                                                   sizeof(U32)));
+#else
+    QLIB_BUS_MODE_T format = qlibContext->busInterface.secureCmdsFormat;
+    U8              op0    = qlibContext->busInterface.op0;
+    BOOL            dtr    = qlibContext->busInterface.dtr;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Perform GET_SSR command                                                                             */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(PLAT_SPI_WriteReadTransaction(qlibContext->userData,
                                                         format,
                                                         dtr,
                                                         op0,
@@ -407,6 +918,7 @@ static _INLINE_ QLIB_STATUS_T QLIB_TM__OP0_get_ssr_L(QLIB_CONTEXT_T* qlibContext
                                                         Q2_SEC_INST_DUMMY_CYCLES__OP0(qlibContext->busInterface.dtr),
                                                         (U8*)&(ssr->asUint),
                                                         sizeof(U32)));
+#endif // QLIB_SPI_DESC_ENABLED
 
     return QLIB_STATUS__OK;
 }
@@ -488,7 +1000,13 @@ exit:
 ************************************************************************************************************/
 static _INLINE_ QLIB_STATUS_T QLIB_TM__OP2_read_obuf_L(QLIB_CONTEXT_T* qlibContext, U32* buf, U32 size)
 {
+#ifdef QLIB_SPI_DESC_ENABLED
+    const QLIB_SPI_DESC_T* desc = &QLIB_TM_GetDescSet_L(qlibContext)->desc[QLIB_SPI_DESC__OP2];
+#endif
 #ifndef QLIB_MAX_SPI_INPUT_SIZE // no limitation of input buffer for SPI
+#ifdef QLIB_SPI_DESC_ENABLED
+    return PLAT_SPI_DescTransaction(qlibContext->userData, desc, 0, NULL, 0, (U8*)buf, size);
+#else
     return PLAT_SPI_WriteReadTransaction(qlibContext->userData,
                                          qlibContext->busInterface.secureCmdsFormat,
                                          qlibContext->busInterface.dtr,
@@ -500,6 +1018,7 @@ static _INLINE_ QLIB_STATUS_T QLIB_TM__OP2_read_obuf_L(QLIB_CONTEXT_T* qlibConte
                                          Q2_SEC_INST_DUMMY_CYCLES__OP2,
                                          (U8*)buf,
                                          size);
+#endif // QLIB_SPI_DESC_ENABLED
 #else
     /*-----------------------------------------------------------------------------------------------------*/
     /* Perform multiple small Read OBUF command for the case that SIP bus not supporting big transactions  */
@@ -510,6 +1029,9 @@ static _INLINE_ QLIB_STATUS_T QLIB_TM__OP2_read_obuf_L(QLIB_CONTEXT_T* qlibConte
     {
         U32 transactionSize = MIN(size, ROUND_DOWN(QLIB_MAX_SPI_INPUT_SIZE, 4));
 
+#ifdef QLIB_SPI_DESC_ENABLED
+        QLIB_STATUS_RET_CHECK(PLAT_SPI_DescTransaction(qlibContext->userData, desc, 0, NULL, 0, tempBuf, transactionSize));
+#else
         QLIB_STATUS_RET_CHECK(PLAT_SPI_WriteReadTransaction(qlibContext->userData,
                                                             qlibContext->busInterface.secureCmdsFormat,
                                                             qlibContext->busInterface.dtr,
@@ -521,6 +1043,7 @@ static _INLINE_ QLIB_STATUS_T QLIB_TM__OP2_read_obuf_L(QLIB_CONTEXT_T* qlibConte
                                                             Q2_SEC_INST_DUMMY_CYCLES__OP2,
                                                             tempBuf,
                                                             transactionSize));
+#endif // QLIB_SPI_DESC_ENABLED
 
         // prepare next iteration
         tempBuf += transactionSize;
@@ -544,12 +1067,17 @@ static QLIB_STATUS_T QLIB_TM_WaitWhileBusySec_L(QLIB_CONTEXT_T* qlibContext, QLI
 {
     QLIB_REG_SSR_T  ssr   = {0};
     QLIB_REG_SSR_T* ssr_p = (userSsr != NULL) ? userSsr : &ssr;
+#ifdef QLIB_PLAT_WAIT_ENABLED
+    U32 pollCount = 0;
+#endif
 
 #ifdef QLIB_SUPPORT_QPI
-    BOOL exitQpi = FALSE;
+    QLIB_STATUS_T ret     = QLIB_STATUS__OK;
+    BOOL          exitQpi = FALSE;
+    QLIB_TM_CRITICAL_VAR_DECLARE(ints);
 
     /*-----------------------------------------------------------------------------------------------------*/
-    /* OP0 doesn't support QPI, exit QPI for op0                                                           */
+    /* OP0 doesn't support QPI, exit QPI for op0 without interruptions                                     */
     /*-----------------------------------------------------------------------------------------------------*/
     if (QLIB_BUS_MODE_4_4_4 == qlibContext->busInterface.secureCmdsFormat)
     {
@@ -557,20 +1085,29 @@ static QLIB_STATUS_T QLIB_TM_WaitWhileBusySec_L(QLIB_CONTEXT_T* qlibContext, QLI
         do
         {
             QLIB_STATUS_RET_CHECK(QLIB_TM_GetStatus_L(qlibContext, &status));
+#ifdef QLIB_PLAT_WAIT_ENABLED
+            if (1 == READ_VAR_FIELD(status.SR1.asUint, SPI_FLASH__STATUS_1_FIELD__BUSY))
+            {
+                QLIB_STATUS_RET_CHECK(PLAT_SPI_WaitWhileBusy(qlibContext->userData, pollCount++));
+            }
+#endif
         } while (1 == READ_VAR_FIELD(status.SR1.asUint, SPI_FLASH__STATUS_1_FIELD__BUSY));
 
         exitQpi = TRUE;
-        QLIB_STATUS_RET_CHECK(PLAT_SPI_WriteReadTransaction(qlibContext->userData,
-                                                            QLIB_BUS_MODE_4_4_4,
-                                                            FALSE,
-                                                            SPI_FLASH_CMD__EXIT_QPI,
-                                                            0,
-                                                            0,
-                                                            NULL,
-                                                            0,
-                                                            0,
-                                                            NULL,
-                                                            0));
+        QLIB_TM_CRITICAL_START(qlibContext, ints);
+        ret = PLAT_SPI_WriteReadTransaction(qlibContext->userData,
+                                            QLIB_BUS_MODE_4_4_4,
+                                            FALSE,
+                                            SPI_FLASH_CMD__EXIT_QPI,
+                                            0,
+                                            0,
+                                            NULL,
+                                            0,
+                                            0,
+                                            NULL,
+                                            0);
+        QLIB_TM_CRITICAL_END(qlibContext, ints);
+        QLIB_STATUS_RET_CHECK(ret);
 
         // After exit QPI temporarily set the format to quad so the follow transactions execute in quad
         qlibContext->busInterface.secureCmdsFormat = QLIB_BUS_MODE_1_1_4;
@@ -611,25 +1148,39 @@ static QLIB_STATUS_T QLIB_TM_WaitWhileBusySec_L(QLIB_CONTEXT_T* qlibContext, QLI
             ssr_p->asUint &= ~SSR__BUSY_BIT;
         }
 
+#ifdef QLIB_PLAT_WAIT_ENABLED
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Let the platform wait (timer, interrupt or OS yield) before the next poll                       */
+        /*-------------------------------------------------------------------------------------------------*/
+        if (ssr_p->asUint & SSR__BUSY_BITS)
+        {
+            QLIB_STATUS_RET_CHECK(PLAT_SPI_WaitWhileBusy(qlibContext->userData, pollCount++));
+        }
+#endif
     } while (ssr_p->asUint & SSR__BUSY_BITS);
 
+    QLIB_TM_SSR_CAPTURED(qlibContext, ssr_p);
+
 #ifdef QLIB_SUPPORT_QPI
     /*-----------------------------------------------------------------------------------------------------*/
-    /* OP0 doesn't support QPI, if we exit QPI for op0 now need to enter back                              */
+    /* OP0 doesn't support QPI, if we exit QPI for op0 now need to enter back without interruptions        */
     /*-----------------------------------------------------------------------------------------------------*/
     if (exitQpi == TRUE)
     {
-        QLIB_STATUS_RET_CHECK(PLAT_SPI_WriteReadTransaction(qlibContext->userData,
-                                                            QLIB_BUS_MODE_1_1_1,
-                                                            FALSE,
-                                                            SPI_FLASH_CMD__ENTER_QPI,
-                                                            0,
-                                                            0,
-                                                            NULL,
-                                                            0,
-                                                            0,
-                                                            NULL,
-                                                            0));
+        QLIB_TM_CRITICAL_START(qlibContext, ints);
+        ret = PLAT_SPI_WriteReadTransaction(qlibContext->userData,
+                                            QLIB_BUS_MODE_1_1_1,
+                                            FALSE,
+                                            SPI_FLASH_CMD__ENTER_QPI,
+                                            0,
+                                            0,
+                                            NULL,
+                                            0,
+                                            0,
+                                            NULL,
+                                            0);
+        QLIB_TM_CRITICAL_END(qlibContext, ints);
+        QLIB_STATUS_RET_CHECK(ret);
 
         // After entering back to QPI set the format back to quad
         qlibContext->busInterface.secureCmdsFormat = QLIB_BUS_MODE_4_4_4;
@@ -649,6 +1200,27 @@ static QLIB_STATUS_T QLIB_TM_WaitWhileBusySec_L(QLIB_CONTEXT_T* qlibContext, QLI
 ************************************************************************************************************/
 static QLIB_STATUS_T QLIB_TM_GetStatus_L(QLIB_CONTEXT_T* qlibContext, STD_FLASH_STATUS_T* status)
 {
+#ifdef QLIB_SPI_DESC_ENABLED
+    const QLIB_SPI_DESC_SET_T* descSet = QLIB_TM_GetDescSet_L(qlibContext);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Perform read status register 1 and 2                                                                */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(PLAT_SPI_DescTransaction(qlibContext->userData,
+                                                   &descSet->desc[QLIB_SPI_DESC__READ_SR1],
+                                                   0,
+                                                   NULL,
+                                                   0,
+                                                   &(status->SR1.asUint),
+                                                   1));
+    QLIB_STATUS_RET_CHECK(PLAT_SPI_DescTransaction(qlibContext->userData,
+                                                   &descSet->desc[QLIB_SPI_DESC__READ_SR2],
+                                                   0,
+                                                   NULL,
+                                                   0,
+                                                   &(status->SR2.asUint),
+                                                   1));
+#else
     /*-----------------------------------------------------------------------------------------------------*/
     /* Perform read status register 1                                                                      */
     /*-----------------------------------------------------------------------------------------------------*/
@@ -678,13 +1250,14 @@ static QLIB_STATUS_T QLIB_TM_GetStatus_L(QLIB_CONTEXT_T* qlibContext, STD_FLASH_
                                                         0,
                                                         &(status->SR2.asUint),
                                                         1));
+#endif // QLIB_SPI_DESC_ENABLED
 
     return QLIB_STATUS__OK;
 }
 
 /************************************************************************************************************
- * @brief       This routine sends standard write enable command, and optionally returns the Flash
- *              status
+ * @brief       This routine sends standard write enable command. It is completed by
+ *              @ref QLIB_TM_WriteEnableWait_L
  *
  * @param[in]   qlibContext   pointer to qlib context
  *
@@ -692,22 +1265,43 @@ static QLIB_STATUS_T QLIB_TM_GetStatus_L(QLIB_CONTEXT_T* qlibContext, STD_FLASH_
 ************************************************************************************************************/
 static QLIB_STATUS_T QLIB_TM_WriteEnable_L(QLIB_CONTEXT_T* qlibContext)
 {
-    STD_FLASH_STATUS_T status;
-
     /*-----------------------------------------------------------------------------------------------------*/
     /* Perform Write Enable                                                                                */
     /*-----------------------------------------------------------------------------------------------------*/
-    QLIB_STATUS_RET_CHECK(PLAT_SPI_WriteReadTransaction(qlibContext->userData,
-                                                        QLIB_STD_GET_BUS_MODE(qlibContext),
-                                                        FALSE,
-                                                        SPI_FLASH_CMD__WRITE_ENABLE,
-                                                        0,
-                                                        0,
-                                                        NULL,
-                                                        0,
-                                                        0,
-                                                        NULL,
-                                                        0));
+#ifdef QLIB_SPI_DESC_ENABLED
+    return PLAT_SPI_DescTransaction(qlibContext->userData,
+                                    &QLIB_TM_GetDescSet_L(qlibContext)->desc[QLIB_SPI_DESC__WRITE_ENABLE],
+                                    0,
+                                    NULL,
+                                    0,
+                                    NULL,
+                                    0);
+#else
+    return PLAT_SPI_WriteReadTransaction(qlibContext->userData,
+                                         QLIB_STD_GET_BUS_MODE(qlibContext),
+                                         FALSE,
+                                         SPI_FLASH_CMD__WRITE_ENABLE,
+                                         0,
+                                         0,
+                                         NULL,
+                                         0,
+                                         0,
+                                         NULL,
+                                         0);
+#endif // QLIB_SPI_DESC_ENABLED
+}
+
+/************************************************************************************************************
+ * @brief       This routine waits for the write enable command sent by @ref QLIB_TM_WriteEnable_L to finish
+ *              and checks that write is enabled
+ *
+ * @param[in]   qlibContext   pointer to qlib context
+ *
+ * @return      QLIB_STATUS__OK if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_TM_WriteEnableWait_L(QLIB_CONTEXT_T* qlibContext)
+{
+    STD_FLASH_STATUS_T status;
 
     /*-----------------------------------------------------------------------------------------------------*/
     /* wait for the command to finish                                                                      */
@@ -728,3 +1322,850 @@ static QLIB_STATUS_T QLIB_TM_WriteEnable_L(QLIB_CONTEXT_T* qlibContext)
 
     return QLIB_STATUS__OK;
 }
+
+/************************************************************************************************************
+ * @brief       This routine marks the transaction manager as executing a transaction.
+ *              Since interrupts are not masked for the whole transaction, it guards against a transaction
+ *              started from an interrupt handler while another transaction is executed.
+ *
+ * @param[in]   qlibContext   pointer to qlib context
+ *
+ * @return      QLIB_STATUS__OK if no error occurred, QLIB_STATUS__DEVICE_BUSY if a transaction is executed
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_TM_Acquire_L(QLIB_CONTEXT_T* qlibContext)
+{
+    QLIB_STATUS_T ret = QLIB_STATUS__OK;
+    INTERRUPTS_VAR_DECLARE(ints);
+
+    INTERRUPTS_SAVE_DISABLE(ints);
+
+    if (0 != qlibContext->tmInTransaction)
+    {
+        ret = QLIB_STATUS__DEVICE_BUSY;
+    }
+    else
+    {
+        qlibContext->tmInTransaction = 1;
+#ifdef QLIB_IRQ_OFF_STATS_SIZE
+        qlibContext->irqOffMaxUs = 0;
+#endif
+    }
+
+    INTERRUPTS_RESTORE(ints);
+
+    return ret;
+}
+
+/************************************************************************************************************
+ * @brief       This routine marks the end of the transaction started by @ref QLIB_TM_Acquire_L
+ *
+ * @param[in]   qlibContext   pointer to qlib context
+************************************************************************************************************/
+static void QLIB_TM_Release_L(QLIB_CONTEXT_T* qlibContext)
+{
+    qlibContext->tmInTransaction = 0;
+}
+
+/************************************************************************************************************
+ * @brief       This routine performs the write phase of a secure command. OP1 doesn't support QPI, so QPI is
+ *              exited before OP1 and entered back by @ref QLIB_TM_SecureReadPhase_L
+ *
+ * @param[in]   qlibContext     pointer to qlib context
+ * @param[in]   ctag            Secure Command CTAG value
+ * @param[in]   writeData       Pointer to output data or NULL if no output data available
+ * @param[in]   writeDataSize   Size of the output data
+ * @param[out]  exitQpi         Set to TRUE if QPI was exited
+ *
+ * @return      QLIB_STATUS__OK if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_TM_SecureWritePhase_L(QLIB_CONTEXT_T* qlibContext,
+                                                U32             ctag,
+                                                const U32*      writeData,
+                                                U32             writeDataSize,
+                                                BOOL*           exitQpi)
+{
+#ifdef QLIB_SUPPORT_QPI
+    QLIB_INTERFACE_T* busInterface = &qlibContext->busInterface;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* OP1 doesn't support QPI, exit for op1                                                               */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (QLIB_BUS_MODE_4_4_4 == busInterface->secureCmdsFormat)
+    {
+        *exitQpi = TRUE;
+        QLIB_STATUS_RET_CHECK(PLAT_SPI_WriteReadTransaction(qlibContext->userData,
+                                                            QLIB_BUS_MODE_4_4_4,
+                                                            FALSE,
+                                                            SPI_FLASH_CMD__EXIT_QPI,
+                                                            0,
+                                                            0,
+                                                            NULL,
+                                                            0,
+                                                            0,
+                                                            NULL,
+                                                            0));
+
+        // After exit QPI temporarily set the format to quad so the follow transactions execute in quad
+        busInterface->secureCmdsFormat = QLIB_BUS_MODE_1_1_4;
+    }
+#else
+    *exitQpi = FALSE;
+#endif // QLIB_SUPPORT_QPI
+
+    return QLIB_TM__OP1_write_ibuf_L(qlibContext, ctag, writeData, writeDataSize);
+}
+
+/************************************************************************************************************
+ * @brief       This routine performs the read phase of a secure command, entering back QPI if it was exited
+ *              by @ref QLIB_TM_SecureWritePhase_L
+ *
+ * @param[in]   qlibContext     pointer to qlib context
+ * @param[out]  readData        Pointer to input data or NULL if no input data required
+ * @param[in]   readDataSize    Size of the input data
+ * @param[out]  ssr             Status register following the wait, error is emulated if response is not ready
+ * @param[in]   enterQpi        TRUE if QPI should be entered back
+ *
+ * @return      QLIB_STATUS__OK if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_TM_SecureReadPhase_L(QLIB_CONTEXT_T* qlibContext,
+                                               U32*            readData,
+                                               U32             readDataSize,
+                                               QLIB_REG_SSR_T* ssr,
+                                               BOOL            enterQpi)
+{
+#ifdef QLIB_SUPPORT_QPI
+    if (enterQpi == TRUE)
+    {
+        QLIB_STATUS_RET_CHECK(PLAT_SPI_WriteReadTransaction(qlibContext->userData,
+                                                            QLIB_BUS_MODE_1_1_1,
+                                                            FALSE,
+                                                            SPI_FLASH_CMD__ENTER_QPI,
+                                                            0,
+                                                            0,
+                                                            NULL,
+                                                            0,
+                                                            0,
+                                                            NULL,
+                                                            0));
+
+        // After entering back to QPI set the format back to quad
+        qlibContext->busInterface.secureCmdsFormat = QLIB_BUS_MODE_4_4_4;
+    }
+#else
+    TOUCH(enterQpi);
+#endif // QLIB_SUPPORT_QPI
+
+    if (0 == readDataSize)
+    {
+        return QLIB_STATUS__OK;
+    }
+
+    if ((ssr != NULL) && (0 == READ_VAR_FIELD(ssr->asUint, QLIB_REG_SSR__RESP_READY)))
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Emulate HW error                                                                                */
+        /*-------------------------------------------------------------------------------------------------*/
+        SET_VAR_FIELD(ssr->asUint, QLIB_REG_SSR__ERR, 1);
+        return QLIB_STATUS__OK;
+    }
+
+    return QLIB_TM__OP2_read_obuf_L(qlibContext, readData, readDataSize);
+}
+
+#ifdef QLIB_SPI_ASYNC_ENABLED
+/************************************************************************************************************
+ * @brief       This routine starts the read phase of a secure command asynchronously. A read phase which does
+ *              not fit a single SPI transaction is performed synchronously.
+ *
+ * @param[in]   qlibContext     pointer to qlib context
+ * @param[out]  readData        Pointer to input data, must remain valid until the read is completed
+ * @param[in]   readDataSize    Size of the input data
+ *
+ * @return      QLIB_STATUS__OK if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_TM_SecureReadPhaseStart_L(QLIB_CONTEXT_T* qlibContext, U32* readData, U32 readDataSize)
+{
+#ifdef QLIB_MAX_SPI_INPUT_SIZE
+    if (readDataSize > ROUND_DOWN(QLIB_MAX_SPI_INPUT_SIZE, 4))
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Read phase does not fit a single transaction, read it synchronously                             */
+        /*-------------------------------------------------------------------------------------------------*/
+        return QLIB_TM__OP2_read_obuf_L(qlibContext, readData, readDataSize);
+    }
+#endif // QLIB_MAX_SPI_INPUT_SIZE
+
+    QLIB_STATUS_RET_CHECK(PLAT_SPI_WriteReadTransaction_Async(qlibContext->userData,
+                                                              qlibContext->busInterface.secureCmdsFormat,
+                                                              qlibContext->busInterface.dtr,
+                                                              qlibContext->busInterface.op2,
+                                                              0,
+                                                              0,
+                                                              NULL,
+                                                              0,
+                                                              Q2_SEC_INST_DUMMY_CYCLES__OP2,
+                                                              (U8*)readData,
+                                                              readDataSize));
+    qlibContext->spiAsyncPending = 1;
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_SPI_ASYNC_ENABLED
+
+#ifdef QLIB_IRQ_OFF_STATS_SIZE
+/************************************************************************************************************
+ * @brief       This routine records the longest interrupts masked window of a transaction
+ *
+ * @param[in]   qlibContext   pointer to qlib context
+ * @param[in]   cmd           SPI command or secure command
+ * @param[in]   secure        TRUE if @p cmd is a secure command
+ * @param[in]   irqOffUs      Longest interrupts masked window of the transaction in microseconds
+************************************************************************************************************/
+static void QLIB_TM_IrqOffRecord_L(QLIB_CONTEXT_T* qlibContext, U8 cmd, BOOL secure, U32 irqOffUs)
+{
+    QLIB_IRQ_OFF_ENTRY_T* entry;
+    U32                   i;
+
+    for (i = 0; i < QLIB_IRQ_OFF_STATS_SIZE; i++)
+    {
+        entry = &qlibContext->irqOffStats.entries[i];
+        if (0 == entry->count)
+        {
+            entry->cmd    = cmd;
+            entry->secure = (U8)secure;
+        }
+        if (cmd == entry->cmd && (U8)secure == entry->secure)
+        {
+            entry->maxUs = MAX(entry->maxUs, irqOffUs);
+            if (MAX_U32 != entry->count)
+            {
+                entry->count++;
+            }
+            return;
+        }
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* No free entry, the command type is accounted with the other command types                           */
+    /*-----------------------------------------------------------------------------------------------------*/
+    qlibContext->irqOffStats.otherMaxUs = MAX(qlibContext->irqOffStats.otherMaxUs, irqOffUs);
+}
+#endif // QLIB_IRQ_OFF_STATS_SIZE
+
+#ifdef QLIB_SEC_READ_AHEAD_ENABLED
+/************************************************************************************************************
+ * @brief       This routine drops the secure read-ahead left in flight by the secure read flow.
+ *              It waits for the in-flight read to complete so the next command can be issued, the read
+ *              data is never fetched.
+ *
+ * @param[in]   qlibContext   pointer to qlib context
+ *
+ * @return      QLIB_STATUS__OK if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_TM_DropReadAhead_L(QLIB_CONTEXT_T* qlibContext)
+{
+    if (0 != qlibContext->readAhead.pending)
+    {
+        qlibContext->readAhead.pending = 0;
+        QLIB_STATUS_RET_CHECK(QLIB_TM_WaitWhileBusySec_L(qlibContext, NULL));
+    }
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_SEC_READ_AHEAD_ENABLED
+
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+/************************************************************************************************************
+ * @brief       This routine exits the continuous read mode, if active.
+ *              The flash expects the address and the mode bits of the next read instead of an instruction, so
+ *              the mode bits of this dummy read end the continuous read mode.
+ *
+ * @param[in]   qlibContext   pointer to qlib context
+ *
+ * @return      QLIB_STATUS__OK if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_TM_ContinuousReadExit_L(QLIB_CONTEXT_T* qlibContext)
+{
+    QLIB_BUS_MODE_T mode;
+
+    if (SPI_FLASH_CMD__NONE == qlibContext->continuousReadCmd)
+    {
+        return QLIB_STATUS__OK;
+    }
+
+    mode = (SPI_FLASH_CMD__READ_FAST__1_4_4 == qlibContext->continuousReadCmd) ? QLIB_BUS_MODE_1_4_4 : QLIB_BUS_MODE_1_2_2;
+    qlibContext->continuousReadCmd = SPI_FLASH_CMD__NONE;
+
+    return PLAT_SPI_ContinuousReadTransaction(qlibContext->userData, mode, FALSE, QLIB_TM_CONTINUOUS_READ_MODE_EXIT, 4, 0, NULL, 0);
+}
+#endif // QLIB_STD_CONTINUOUS_READ_ENABLED
+
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+/************************************************************************************************************
+ * @brief       This routine finds the model entry of an operation and waits until just before its predicted
+ *              completion. An operation which is not in the model replaces the least measured entry.
+ *              Until the entry has enough measurements, the prediction is the SFDP typical time, if known.
+ *
+ * @param[in]   qlibContext   pointer to qlib context
+ * @param[in]   cmd           SPI command or secure command
+ * @param[in]   secure        TRUE if @p cmd is a secure command
+ * @param[in]   size          Write data size in bytes
+ * @param[in]   startUs       Time the command was issued, returned by PLAT_GetTimeUs
+ *
+ * @return      Model entry of the operation
+************************************************************************************************************/
+static QLIB_OP_TIME_ENTRY_T* QLIB_TM_OpTimeStart_L(QLIB_CONTEXT_T* qlibContext, U8 cmd, BOOL secure, U32 size, U32 startUs)
+{
+    QLIB_OP_TIME_ENTRY_T* entry  = NULL;
+    QLIB_OP_TIME_ENTRY_T* victim = NULL;
+    U32                   avgUs;
+    U32                   predictedUs = 0;
+    U32                   elapsedUs;
+    U32                   i;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Find the operation entry                                                                            */
+    /*-----------------------------------------------------------------------------------------------------*/
+    for (i = 0; i < QLIB_OP_TIME_MODEL_SIZE; i++)
+    {
+        entry = &qlibContext->opTimeModel.entries[i];
+        if (0 != entry->count && cmd == entry->cmd && (U8)secure == entry->secure && (U16)size == entry->size)
+        {
+            break;
+        }
+        if (NULL == victim || entry->count < victim->count)
+        {
+            victim = entry;
+        }
+        entry = NULL;
+    }
+
+    if (NULL == entry)
+    {
+        memset(victim, 0, sizeof(QLIB_OP_TIME_ENTRY_T));
+        victim->cmd    = cmd;
+        victim->secure = (U8)secure;
+        victim->size   = (U16)size;
+        entry          = victim;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Poll just before the predicted completion, with a margin of 1/8 of the average                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (QLIB_OP_TIME_MIN_SAMPLES <= entry->count)
+    {
+        avgUs       = entry->ewma >> QLIB_OP_TIME_EWMA_SHIFT;
+        predictedUs = MIN(entry->minUs, avgUs - (avgUs >> 3));
+    }
+#ifdef QLIB_STD_SFDP_ENABLED
+    else
+    {
+        avgUs       = QLIB_TM_SfdpTypicalUs_L(qlibContext, cmd, secure, size);
+        predictedUs = avgUs - (avgUs >> 3);
+    }
+#endif
+
+    if (0 != predictedUs)
+    {
+        elapsedUs = PLAT_GetTimeUs() - startUs;
+
+        if (predictedUs > elapsedUs)
+        {
+            PLAT_DelayUs(qlibContext->userData, predictedUs - elapsedUs);
+        }
+    }
+
+    return entry;
+}
+
+#ifdef QLIB_STD_SFDP_ENABLED
+/************************************************************************************************************
+ * @brief       This routine returns the SFDP typical time of an erase or program operation
+ *
+ * @param[in]   qlibContext   pointer to qlib context
+ * @param[in]   cmd           SPI command or secure command
+ * @param[in]   secure        TRUE if @p cmd is a secure command
+ * @param[in]   size          Write data size in bytes
+ *
+ * @return      Typical time in microseconds, 0 if unknown
+************************************************************************************************************/
+static U32 QLIB_TM_SfdpTypicalUs_L(const QLIB_CONTEXT_T* qlibContext, U8 cmd, BOOL secure, U32 size)
+{
+    const QLIB_SFDP_T* sfdp      = &qlibContext->sfdp;
+    U32                eraseSize = 0;
+    U32                t;
+
+    if (TRUE != sfdp->valid)
+    {
+        return 0;
+    }
+
+    if (TRUE == secure)
+    {
+        switch (cmd)
+        {
+            case QLIB_CMD_SEC_SERASE_4:
+                eraseSize = _4KB_;
+                break;
+            case QLIB_CMD_SEC_SERASE_32:
+                eraseSize = _32KB_;
+                break;
+            case QLIB_CMD_SEC_SERASE_64:
+                eraseSize = _64KB_;
+                break;
+            case QLIB_CMD_SEC_SERASE_ALL:
+                return sfdp->chipEraseTypicalUs;
+            default:
+                return 0;
+        }
+    }
+    else
+    {
+        switch (cmd)
+        {
+            case SPI_FLASH_CMD__ERASE_SECTOR:
+                eraseSize = _4KB_;
+                break;
+            case SPI_FLASH_CMD__ERASE_BLOCK_32:
+                eraseSize = _32KB_;
+                break;
+            case SPI_FLASH_CMD__ERASE_BLOCK_64:
+                eraseSize = _64KB_;
+                break;
+            case SPI_FLASH_CMD__ERASE_CHIP:
+            case SPI_FLASH_CMD__ERASE_CHIP_DEPRECATED:
+                return sfdp->chipEraseTypicalUs;
+            case SPI_FLASH_CMD__PAGE_PROGRAM:
+            case SPI_FLASH_CMD__PAGE_PROGRAM_1_1_4:
+                // The typical time is given for a full page
+                if (0 == sfdp->pageSize)
+                {
+                    return 0;
+                }
+                return (U32)(((U64)sfdp->pageProgramTypicalUs * MIN(size, sfdp->pageSize)) / sfdp->pageSize);
+            default:
+                return 0;
+        }
+    }
+
+    for (t = 0; t < QLIB_SFDP_ERASE_TYPES; t++)
+    {
+        if (eraseSize == sfdp->eraseSize[t])
+        {
+            return sfdp->eraseTypicalUs[t];
+        }
+    }
+
+    return 0;
+}
+#endif // QLIB_STD_SFDP_ENABLED
+
+/************************************************************************************************************
+ * @brief       This routine updates the model entry of an operation with its completion time
+ *
+ * @param[out]  entry     Model entry of the operation
+ * @param[in]   startUs   Time the command was issued, returned by PLAT_GetTimeUs
+************************************************************************************************************/
+static void QLIB_TM_OpTimeEnd_L(QLIB_OP_TIME_ENTRY_T* entry, U32 startUs)
+{
+    U32 timeUs = MIN(PLAT_GetTimeUs() - startUs, MAX_U32 >> QLIB_OP_TIME_EWMA_SHIFT);
+    U32 bucket = 0;
+    U32 i;
+
+    if (0 == entry->count)
+    {
+        entry->ewma  = timeUs << QLIB_OP_TIME_EWMA_SHIFT;
+        entry->minUs = timeUs;
+        entry->maxUs = timeUs;
+    }
+    else
+    {
+        entry->ewma  = entry->ewma - (entry->ewma >> QLIB_OP_TIME_EWMA_SHIFT) + timeUs;
+        entry->minUs = MIN(entry->minUs, timeUs);
+        entry->maxUs = MAX(entry->maxUs, timeUs);
+    }
+
+    if (MAX_U32 != entry->count)
+    {
+        entry->count++;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Update the histogram, halve it when a bucket is saturated so old samples fade out                   */
+    /*-----------------------------------------------------------------------------------------------------*/
+    while (bucket < (QLIB_OP_TIME_HISTOGRAM_SIZE - 1) && 0 != (timeUs >> (bucket + 1)))
+    {
+        bucket++;
+    }
+
+    if (MAX_U16 == entry->histogram[bucket])
+    {
+        for (i = 0; i < QLIB_OP_TIME_HISTOGRAM_SIZE; i++)
+        {
+            entry->histogram[i] >>= 1;
+        }
+    }
+    entry->histogram[bucket]++;
+}
+
+/************************************************************************************************************
+ * @brief       This routine returns a percentile of the completion time, interpolated inside the histogram
+ *              bucket
+ *
+ * @param[in]   entry     Model entry of the operation
+ * @param[in]   percent   Percentile (1-100)
+ *
+ * @return      Completion time percentile in microseconds
+************************************************************************************************************/
+static U32 QLIB_TM_OpTimePercentile_L(const QLIB_OP_TIME_ENTRY_T* entry, U32 percent)
+{
+    U32 total   = 0;
+    U32 sum     = 0;
+    U32 target  = 0;
+    U32 lowUs   = 0;
+    U32 valueUs = 0;
+    U32 bucket;
+
+    for (bucket = 0; bucket < QLIB_OP_TIME_HISTOGRAM_SIZE; bucket++)
+    {
+        total += entry->histogram[bucket];
+    }
+
+    target = ((total * percent) + 99) / 100;
+
+    for (bucket = 0; bucket < QLIB_OP_TIME_HISTOGRAM_SIZE; bucket++)
+    {
+        if (0 != entry->histogram[bucket] && sum + entry->histogram[bucket] >= target)
+        {
+            lowUs   = (0 == bucket) ? 0 : (1UL << bucket);
+            valueUs = lowUs + (U32)(((U64)((2UL << bucket) - lowUs) * (target - sum)) / entry->histogram[bucket]);
+            break;
+        }
+        sum += entry->histogram[bucket];
+    }
+
+    return MIN(MAX(valueUs, entry->minUs), entry->maxUs);
+}
+#endif // QLIB_OP_TIME_MODEL_SIZE
+
+#ifdef QLIB_SPI_LIST_ENABLED
+/************************************************************************************************************
+ * @brief       This routine performs the write phase of a secure command as a single SPI transaction list:
+ *              exit QPI if needed and OP1. QPI is entered back by @ref QLIB_TM_SecureListRead_L
+ *
+ * @param[in]   qlibContext     pointer to qlib context
+ * @param[in]   ctag            Secure Command CTAG value
+ * @param[in]   writeData       Pointer to output data or NULL if no output data required
+ * @param[in]   writeDataSize   Size of the output data
+ * @param[out]  exitQpi         Set to TRUE if QPI was exited
+ *
+ * @return      QLIB_STATUS__OK if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_TM_SecureListWrite_L(QLIB_CONTEXT_T* qlibContext,
+                                               U32             ctag,
+                                               const U32*      writeData,
+                                               U32             writeDataSize,
+                                               BOOL*           exitQpi)
+{
+    QLIB_INTERFACE_T*       busInterface = &qlibContext->busInterface;
+    QLIB_SPI_TRANSACTION_T  list[QLIB_TM_SPI_LIST_WRITE_SIZE];
+    QLIB_SPI_TRANSACTION_T* entry     = list;
+    QLIB_BUS_MODE_T         op1Format = busInterface->secureCmdsFormat;
+    U8                      op1       = busInterface->op1;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(writeDataSize <= Q2_MAX_IBUF_SIZE_BYTE, QLIB_STATUS__INVALID_DATA_SIZE);
+#if defined QLIB_MAX_SPI_OUTPUT_SIZE
+    // sending OP1 + CTAG + DATA on SPI
+    QLIB_ASSERT_RET(1 + Q2_CTAG_SIZE_BYTE + writeDataSize <= QLIB_MAX_SPI_OUTPUT_SIZE, QLIB_STATUS__INVALID_DATA_SIZE);
+#endif
+
+    memset(list, 0, sizeof(list));
+    *exitQpi = FALSE;
+
+#ifdef QLIB_SUPPORT_QPI
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* OP0 and OP1 don't support QPI, exit QPI for the command                                             */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (QLIB_BUS_MODE_4_4_4 == op1Format)
+    {
+        *exitQpi      = TRUE;
+        op1Format     = QLIB_BUS_MODE_1_1_4;
+        entry->format = QLIB_BUS_MODE_4_4_4;
+        entry->cmd    = SPI_FLASH_CMD__EXIT_QPI;
+        entry++;
+    }
+#endif // QLIB_SUPPORT_QPI
+
+#ifdef QLIB_SUPPORT_DUAL_SPI
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* OP1 doesn't support DUAL                                                                            */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if ((op1Format == QLIB_BUS_MODE_1_1_2) || (op1Format == QLIB_BUS_MODE_1_2_2))
+    {
+        op1Format = QLIB_BUS_MODE_1_1_1; // Bus-mode: single
+        op1       = 0xA1;                // OP code:  single
+    }
+#endif
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Write IBUF, OP1 doesn't support DTR                                                                 */
+    /*-----------------------------------------------------------------------------------------------------*/
+    entry->format      = op1Format;
+    entry->cmd         = op1;
+    entry->address     = MAKE_32_BIT(BYTE(ctag, 3), BYTE(ctag, 2), BYTE(ctag, 1), BYTE(ctag, 0));
+    entry->addressSize = Q2_CTAG_SIZE_BYTE;
+    entry->dataOut     = (const U8*)writeData;
+    entry->dataOutSize = writeDataSize;
+    entry++;
+
+    QLIB_STATUS_RET_CHECK(PLAT_SPI_TransactionList(qlibContext->userData, list, (U32)(entry - list)));
+
+#ifdef QLIB_SUPPORT_QPI
+    if (TRUE == *exitQpi)
+    {
+        // After exit QPI temporarily set the format to quad so the follow transactions execute in quad
+        busInterface->secureCmdsFormat = QLIB_BUS_MODE_1_1_4;
+    }
+#endif
+
+    return QLIB_STATUS__OK;
+}
+
+/************************************************************************************************************
+ * @brief       This routine polls the SSR of a secure command as a single SPI transaction list: OP0 while busy
+ *              (twice for SAWR). The list is executed with interrupts enabled, the platform may wait between polls
+ *
+ * @param[in]   qlibContext     pointer to qlib context
+ * @param[in]   cmd             Secure command
+ * @param[out]  ssr             Status register following the wait
+ *
+ * @return      QLIB_STATUS__OK if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_TM_SecureListPoll_L(QLIB_CONTEXT_T* qlibContext, U8 cmd, QLIB_REG_SSR_T* ssr)
+{
+    const QLIB_INTERFACE_T* busInterface = &qlibContext->busInterface;
+    QLIB_SPI_TRANSACTION_T  list[QLIB_TM_SPI_LIST_POLL_SIZE];
+    QLIB_SPI_TRANSACTION_T* entry = list;
+    U32                     polls = (QLIB_CMD_SEC_SAWR == cmd) ? 2 : 1;
+
+    memset(list, 0, sizeof(list));
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Get SSR while busy, if response is there we do not keep on waiting till busy goes off               */
+    /*-----------------------------------------------------------------------------------------------------*/
+    while (0 != polls--)
+    {
+        entry->format          = busInterface->secureCmdsFormat;
+        entry->dtr             = busInterface->dtr;
+        entry->cmd             = busInterface->op0;
+        entry->dummyCycles     = Q2_SEC_INST_DUMMY_CYCLES__OP0(busInterface->dtr);
+        entry->dataIn          = (U8*)&(ssr->asUint);
+        entry->dataInSize      = sizeof(U32);
+        entry->repeatWhileMask = SSR__BUSY_BITS;
+        entry->repeatUntilMask = SSR__RESP_READY_BIT;
+        entry++;
+    }
+
+    QLIB_STATUS_RET_CHECK(PLAT_SPI_TransactionList(qlibContext->userData, list, (U32)(entry - list)));
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Check if flash is alive                                                                             */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (ssr->asUint == MAX_U32 || ssr->asUint == 0)
+    {
+        return QLIB_STATUS__CONNECTIVITY_ERR;
+    }
+
+    if (ssr->asUint & SSR__RESP_READY_BIT)
+    {
+        ssr->asUint &= ~SSR__BUSY_BIT;
+    }
+
+    QLIB_TM_SSR_CAPTURED(qlibContext, ssr);
+
+    return QLIB_STATUS__OK;
+}
+
+/************************************************************************************************************
+ * @brief       This routine performs the read phase of a secure command as a single SPI transaction list:
+ *              enter QPI back if needed and OP2 if the response is ready
+ *
+ * @param[in]   qlibContext     pointer to qlib context
+ * @param[out]  readData        Pointer to input data or NULL if no input data required
+ * @param[in]   readDataSize    Size of the input data
+ * @param[out]  ssr             Status register following the wait, error is emulated if response is not ready
+ * @param[in]   enterQpi        TRUE if QPI should be entered back
+ *
+ * @return      QLIB_STATUS__OK if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+static QLIB_STATUS_T QLIB_TM_SecureListRead_L(QLIB_CONTEXT_T* qlibContext,
+                                              U32*            readData,
+                                              U32             readDataSize,
+                                              QLIB_REG_SSR_T* ssr,
+                                              BOOL            enterQpi)
+{
+    QLIB_INTERFACE_T*       busInterface = &qlibContext->busInterface;
+    QLIB_SPI_TRANSACTION_T  list[QLIB_TM_SPI_LIST_READ_SIZE];
+    QLIB_SPI_TRANSACTION_T* entry   = list;
+    QLIB_BUS_MODE_T         format  = busInterface->secureCmdsFormat;
+    U8*                     readBuf = (U8*)readData;
+
+    memset(list, 0, sizeof(list));
+
+#ifdef QLIB_SUPPORT_QPI
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Enter back QPI                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (TRUE == enterQpi)
+    {
+        format        = QLIB_BUS_MODE_4_4_4;
+        entry->format = QLIB_BUS_MODE_1_1_1;
+        entry->cmd    = SPI_FLASH_CMD__ENTER_QPI;
+        entry++;
+    }
+#else
+    TOUCH(enterQpi);
+#endif // QLIB_SUPPORT_QPI
+
+    if (0 != readDataSize && 0 == (ssr->asUint & SSR__RESP_READY_BIT))
+    {
+        /*-------------------------------------------------------------------------------------------------*/
+        /* OBUF is not read, emulate HW error                                                              */
+        /*-------------------------------------------------------------------------------------------------*/
+        SET_VAR_FIELD(ssr->asUint, QLIB_REG_SSR__ERR, 1);
+        readDataSize = 0;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Read OBUF                                                                                           */
+    /*-----------------------------------------------------------------------------------------------------*/
+    while (0 != readDataSize)
+    {
+        entry->format      = format;
+        entry->dtr         = busInterface->dtr;
+        entry->cmd         = busInterface->op2;
+        entry->dummyCycles = Q2_SEC_INST_DUMMY_CYCLES__OP2;
+        entry->dataIn      = readBuf;
+        entry->dataInSize  = MIN(readDataSize, QLIB_TM_SPI_LIST_OP2_CHUNK);
+        readBuf += entry->dataInSize;
+        readDataSize -= entry->dataInSize;
+        entry++;
+    }
+
+    if (entry == list)
+    {
+        return QLIB_STATUS__OK;
+    }
+
+    QLIB_STATUS_RET_CHECK(PLAT_SPI_TransactionList(qlibContext->userData, list, (U32)(entry - list)));
+
+#ifdef QLIB_SUPPORT_QPI
+    if (TRUE == enterQpi)
+    {
+        // After entering back to QPI set the format back to quad
+        busInterface->secureCmdsFormat = QLIB_BUS_MODE_4_4_4;
+    }
+#endif
+
+    return QLIB_STATUS__OK;
+}
+
+#endif // QLIB_SPI_LIST_ENABLED
+
+#ifdef QLIB_SPI_DESC_ENABLED
+/************************************************************************************************************
+ * @brief       This routine returns the SPI transaction descriptors of the current bus format.
+ *              The descriptors are built once per bus format, the set of the last used format is looked up first.
+ *              A missing set is built in place of the next set in round-robin order, which for the two sets
+ *              of QLIB_SPI_DESC_SETS is the set not used last
+ *
+ * @param[in]   qlibContext   pointer to qlib context
+ *
+ * @return      Transaction descriptors set
+************************************************************************************************************/
+static const QLIB_SPI_DESC_SET_T* QLIB_TM_GetDescSet_L(QLIB_CONTEXT_T* qlibContext)
+{
+    const QLIB_INTERFACE_T* busInterface = &qlibContext->busInterface;
+    QLIB_BUS_MODE_T         stdFormat    = QLIB_STD_GET_BUS_MODE(qlibContext);
+    QLIB_SPI_DESC_SET_T*    set          = NULL;
+    U32                     index        = 0;
+    U32                     i;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Look for a set built for the current format                                                         */
+    /*-----------------------------------------------------------------------------------------------------*/
+    for (i = 0; i < QLIB_SPI_DESC_SETS; i++)
+    {
+        index = (qlibContext->spiDescLast + i) % QLIB_SPI_DESC_SETS;
+        set   = &qlibContext->spiDesc[index];
+
+        if (0 != set->valid && set->secureCmdsFormat == busInterface->secureCmdsFormat && set->stdFormat == stdFormat &&
+            set->dtr == busInterface->dtr && set->op0 == busInterface->op0 && set->op2 == busInterface->op2)
+        {
+            qlibContext->spiDescLast = (U8)index;
+            return set;
+        }
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Not found, build the descriptors in place of the set following the last used one (round-robin)      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    index                    = (qlibContext->spiDescLast + 1) % QLIB_SPI_DESC_SETS;
+    set                      = &qlibContext->spiDesc[index];
+    set->secureCmdsFormat    = busInterface->secureCmdsFormat;
+    set->stdFormat           = stdFormat;
+    set->dtr                 = busInterface->dtr;
+    set->op0                 = busInterface->op0;
+    set->op2                 = busInterface->op2;
+    qlibContext->spiDescLast = (U8)index;
+
+    QLIB_TM_BuildDesc_L(qlibContext,
+                        &set->desc[QLIB_SPI_DESC__OP0],
+                        set->secureCmdsFormat,
+                        set->dtr,
+                        set->op0,
+                        Q2_SEC_INST_DUMMY_CYCLES__OP0(set->dtr));
+    QLIB_TM_BuildDesc_L(qlibContext,
+                        &set->desc[QLIB_SPI_DESC__OP2],
+                        set->secureCmdsFormat,
+                        set->dtr,
+                        set->op2,
+                        Q2_SEC_INST_DUMMY_CYCLES__OP2);
+    QLIB_TM_BuildDesc_L(qlibContext, &set->desc[QLIB_SPI_DESC__READ_SR1], stdFormat, FALSE, SPI_FLASH_CMD__READ_STATUS_REGISTER_1, 0);
+    QLIB_TM_BuildDesc_L(qlibContext, &set->desc[QLIB_SPI_DESC__READ_SR2], stdFormat, FALSE, SPI_FLASH_CMD__READ_STATUS_REGISTER_2, 0);
+    QLIB_TM_BuildDesc_L(qlibContext, &set->desc[QLIB_SPI_DESC__WRITE_ENABLE], stdFormat, FALSE, SPI_FLASH_CMD__WRITE_ENABLE, 0);
+    set->valid = 1;
+
+    return set;
+}
+
+/************************************************************************************************************
+ * @brief       This routine builds SPI transaction descriptor without address and lets the platform pre-encode it
+ *
+ * @param[in]   qlibContext   pointer to qlib context
+ * @param[out]  desc          Transaction descriptor
+ * @param[in]   format        SPI format
+ * @param[in]   dtr           DTR
+ * @param[in]   cmd           SPI command
+ * @param[in]   dummyCycles   Dummy cycles between write and read phases
+************************************************************************************************************/
+static void QLIB_TM_BuildDesc_L(QLIB_CONTEXT_T*  qlibContext,
+                                QLIB_SPI_DESC_T* desc,
+                                QLIB_BUS_MODE_T  format,
+                                BOOL             dtr,
+                                U8               cmd,
+                                U8               dummyCycles)
+{
+    memset(desc, 0, sizeof(QLIB_SPI_DESC_T));
+    desc->format      = format;
+    desc->dtr         = dtr;
+    desc->cmd         = cmd;
+    desc->addressSize = 0;
+    desc->dummyCycles = dummyCycles;
+
+    PLAT_SPI_DescEncode(qlibContext->userData, desc);
+}
+#endif // QLIB_SPI_DESC_ENABLED
@@ -119,6 +119,79 @@ QLIB_STATUS_T QLIB_TM_Secure(QLIB_CONTEXT_T* qlibContext,
                              U32             readDataSize,
                              QLIB_REG_SSR_T* ssr) __RAM_SECTION;
 
+#ifdef QLIB_SPI_ASYNC_ENABLED
+/************************************************************************************************************
+ * @brief       This function waits while the flash is busy and starts reading the secure command response
+ *              asynchronously. The read is completed by @ref QLIB_TM_Secure_ReadWait, or by the next
+ *              transaction manager call.
+ *
+ * @param[in]   qlibContext      pointer to the sec qlib context
+ * @param[out]  readData         Pointer to input data, must remain valid until the read is completed
+ * @param[in]   readDataSize     Size of the input data
+ * @param[out]  ssr              Pointer to status register following the wait
+ *
+ * @return      0 if no error occurred, Q2_STATUS_(ERROR) otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_TM_Secure_ReadStart(QLIB_CONTEXT_T* qlibContext, U32* readData, U32 readDataSize, QLIB_REG_SSR_T* ssr)
+    __RAM_SECTION;
+
+/************************************************************************************************************
+ * @brief       This function waits for the read started by @ref QLIB_TM_Secure_ReadStart to complete.
+ *              It returns immediately if no read is in flight.
+ *
+ * @param[in]   qlibContext      pointer to the sec qlib context
+ *
+ * @return      0 if no error occurred, Q2_STATUS_(ERROR) otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_TM_Secure_ReadWait(QLIB_CONTEXT_T* qlibContext) __RAM_SECTION;
+#endif // QLIB_SPI_ASYNC_ENABLED
+
+#ifdef QLIB_STD_CONTINUOUS_READ_ENABLED
+/************************************************************************************************************
+ * @brief       This function performs a standard read in continuous read mode.
+ *              The first read sends the instruction and the mode bits which keep the flash in continuous read
+ *              mode, the following reads with the same instruction skip it. The continuous read mode is
+ *              exited before any other transaction. The flash status is not polled after the read.
+ *
+ * @param[in]   qlibContext       pointer to qlib context
+ * @param[in]   format            SPI transaction format, QLIB_BUS_MODE_1_2_2 or QLIB_BUS_MODE_1_4_4 without dtr
+ * @param[in]   cmd               Fast read command value matching the format
+ * @param[in]   address           Address value
+ * @param[in]   dummyCycles       Delay Cycles between address and read phases, including the mode bits
+ * @param[out]  readData          Pointer to input data
+ * @param[in]   readDataSize      Size of the input data
+ *
+ * @return      0 if no error occurred, QLIB_STATUS__(ERROR) otherwise
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_TM_StandardContinuousRead(QLIB_CONTEXT_T*   qlibContext,
+                                             QLIB_BUS_FORMAT_T format,
+                                             U8                cmd,
+                                             U32               address,
+                                             U32               dummyCycles,
+                                             U8*               readData,
+                                             U32               readDataSize) __RAM_SECTION;
+#endif // QLIB_STD_CONTINUOUS_READ_ENABLED
+
+#ifdef QLIB_OP_TIME_MODEL_SIZE
+/************************************************************************************************************
+ * @brief       This function returns the learned completion times of the program, erase and signature
+ *              operations
+ *
+ * @param[in]   qlibContext      pointer to the sec qlib context
+ * @param[out]  stats            Statistics of up to @p maxEntries operation types
+ * @param[in]   maxEntries       Number of entries in @p stats
+ * @param[out]  numEntries       Number of learned operation types
+************************************************************************************************************/
+void QLIB_TM_OpTimeGetStats(QLIB_CONTEXT_T* qlibContext, QLIB_OP_TIME_STATS_T* stats, U32 maxEntries, U32* numEntries);
+
+/************************************************************************************************************
+ * @brief       This function clears the learned completion times
+ *
+ * @param[in]   qlibContext      pointer to the sec qlib context
+************************************************************************************************************/
+void QLIB_TM_OpTimeReset(QLIB_CONTEXT_T* qlibContext);
+#endif // QLIB_OP_TIME_MODEL_SIZE
+
 #ifdef __cplusplus
 }
 #endif
@@ -17,6 +17,7 @@
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 #include "qlib_utils_crc.h"
+#include "qlib_utils_digest.h"
 
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
@@ -42,7 +43,10 @@ static const U32 table32[] = {
 /*                                          FORWARD DECLARATION                                            */
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
-static U32 QLIB_UTILS_CRC_churn32_L(U32 x);
+static U32  QLIB_UTILS_CRC_churn32_L(U32 x);
+static U32  QLIB_UTILS_CRC_MatrixTimes_L(const U32* matrix, U32 vector);
+static void QLIB_UTILS_CRC_MatrixSquare_L(U32* square, const U32* matrix);
+static U32  QLIB_UTILS_CRC_Extend_L(U32 state, U32 padValue, U32 padWords);
 
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
@@ -77,39 +81,331 @@ QLIB_STATUS_T QLIB_UTILS_CalcCRCWithPadding(const U32* buf, U32 size, U32 padVal
         res = QLIB_UTILS_CRC_churn32_L(buf[i] ^ res);
     }
 
-    for (i = 0; i < padSize / sizeof(U32); ++i)
-    {
-        res = QLIB_UTILS_CRC_churn32_L(padValue ^ res);
-    }
+    res = QLIB_UTILS_CRC_Extend_L(res, padValue, padSize / sizeof(U32));
 
     *crc = (res ^ 0xFFFFFFFF);
 
     return QLIB_STATUS__OK;
 }
 
+QLIB_STATUS_T QLIB_UTILS_CRCExtend(U32 crc, U32 padValue, U32 padSize, U32* extendedCrc)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != extendedCrc, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 == (padSize % (sizeof(U32))), QLIB_STATUS__INVALID_PARAMETER);
+
+    *extendedCrc = QLIB_UTILS_CRC_Extend_L(crc ^ 0xFFFFFFFF, padValue, padSize / sizeof(U32)) ^ 0xFFFFFFFF;
+
+    return QLIB_STATUS__OK;
+}
+
+QLIB_STATUS_T QLIB_UTILS_CRCCombine(U32 crc1, U32 crc2, U32 size2, U32* crc)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != crc, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 == (size2 % (sizeof(U32))), QLIB_STATUS__INVALID_PARAMETER);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* The initial and final values cancel out, crc(1|2) = M^n * crc(1) ^ crc(2), n = words of 2          */
+    /*-----------------------------------------------------------------------------------------------------*/
+    *crc = QLIB_UTILS_CRC_Extend_L(crc1, 0, size2 / sizeof(U32)) ^ crc2;
+
+    return QLIB_STATUS__OK;
+}
+
 QLIB_STATUS_T QLIB_UTILS_CalcCRCForSection(QLIB_CONTEXT_T* qlibContext, U32 sectionId, U32 offset, U32 dataSize, U32* crc)
+{
+    U32 readBuf[QLIB_UTILS_CRC_READ_BUFFER_SIZE / sizeof(U32)];
+
+    return QLIB_UTILS_ScanSection(qlibContext, sectionId, offset, dataSize, readBuf, sizeof(readBuf), crc, NULL, NULL);
+}
+
+QLIB_STATUS_T QLIB_UTILS_ScanSection(QLIB_CONTEXT_T*          qlibContext,
+                                     U32                      sectionId,
+                                     U32                      offset,
+                                     U32                      dataSize,
+                                     U32*                     buf,
+                                     U32                      bufSize,
+                                     U32*                     crc,
+                                     U64*                     digest,
+                                     QLIB_UTILS_SCAN_STATS_T* stats)
 {
     U32 res = 0xFFFFFFFFL;
     U32 i   = 0;
-    U32 readBuf[QLIB_UTILS_CRC_READ_BUFFER_SIZE / sizeof(U32)];
     U32 readSize;
+#ifdef QLIB_HASH_STREAM_ENABLED
+    QLIB_UTILS_DIGEST_CTX_T digestCtx;
+#endif
+#ifdef QLIB_UTILS_SCAN_STATS_ENABLED
+    U32 startUs;
+    U32 readUs;
+    U32 calcUs;
+#endif
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != buf, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != crc || NULL != digest, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 < bufSize && 0 == (bufSize % (sizeof(U32))), QLIB_STATUS__INVALID_PARAMETER);
+
+#ifdef QLIB_HASH_STREAM_ENABLED
+    if (NULL != digest)
+    {
+        QLIB_STATUS_RET_CHECK(QLIB_UTILS_DigestInit(&digestCtx));
+    }
+#else
+    QLIB_ASSERT_RET(NULL == digest, QLIB_STATUS__NOT_SUPPORTED);
+#endif
 
+    if (NULL != stats)
+    {
+        memset(stats, 0, sizeof(QLIB_UTILS_SCAN_STATS_T));
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Read each chunk once and add it to both the CRC and the digest. The reads are sequential, so the    */
+    /* secure read-ahead keeps the next read in flight during the calculation                              */
+    /*-----------------------------------------------------------------------------------------------------*/
     while (dataSize > 0)
     {
-        readSize = MIN(dataSize, sizeof(readBuf));
-        QLIB_STATUS_RET_CHECK(QLIB_Read(qlibContext, (U8*)readBuf, sectionId, offset, readSize, TRUE, FALSE));
-        for (i = 0; i < (readSize / sizeof(U32)); i++)
+        readSize = MIN(dataSize, bufSize);
+#ifdef QLIB_UTILS_SCAN_STATS_ENABLED
+        startUs = PLAT_GetTimeUs();
+#endif
+        QLIB_STATUS_RET_CHECK(QLIB_Read(qlibContext, (U8*)buf, sectionId, offset, readSize, TRUE, FALSE));
+#ifdef QLIB_UTILS_SCAN_STATS_ENABLED
+        readUs = PLAT_GetTimeUs();
+#endif
+        if (NULL != crc)
+        {
+            for (i = 0; i < (readSize / sizeof(U32)); i++)
+            {
+                res = QLIB_UTILS_CRC_churn32_L(buf[i] ^ res);
+            }
+        }
+#ifdef QLIB_HASH_STREAM_ENABLED
+        if (NULL != digest)
+        {
+            QLIB_STATUS_RET_CHECK(QLIB_UTILS_DigestUpdate(&digestCtx, (const U8*)buf, readSize));
+        }
+#endif
+        if (NULL != stats)
         {
-            res  = QLIB_UTILS_CRC_churn32_L(readBuf[i] ^ res);
+#ifdef QLIB_UTILS_SCAN_STATS_ENABLED
+            calcUs = PLAT_GetTimeUs();
+            stats->readUs += readUs - startUs;
+            stats->calcUs += calcUs - readUs;
+#endif
+            stats->size += readSize;
+            stats->chunks++;
         }
         dataSize -= readSize;
         offset += readSize;
     }
-    *crc = (res ^ 0xFFFFFFFF);
+
+    if (NULL != crc)
+    {
+        *crc = (res ^ 0xFFFFFFFF);
+    }
+#ifdef QLIB_HASH_STREAM_ENABLED
+    if (NULL != digest)
+    {
+        QLIB_STATUS_RET_CHECK(QLIB_UTILS_DigestFinal(&digestCtx, digest));
+    }
+#endif
+
+#ifdef QLIB_UTILS_SCAN_STATS_ENABLED
+    if (NULL != stats && 0 != (stats->readUs + stats->calcUs))
+    {
+        stats->bytesPerSec = (U32)(((U64)stats->size * 1000000) / (stats->readUs + stats->calcUs));
+    }
+#endif
 
     return QLIB_STATUS__OK;
 }
 
+#ifdef QLIB_UTILS_SCRUB_ENABLED
+QLIB_STATUS_T QLIB_UTILS_ScrubStart(QLIB_CONTEXT_T*         qlibContext,
+                                    QLIB_UTILS_SCRUB_CTX_T* scrub,
+                                    U32                     sectionId,
+                                    QLIB_INTEGRITY_T        integrityType)
+{
+    QLIB_POLICY_T policy;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != scrub, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET((QLIB_INTEGRITY_CRC == integrityType) || (QLIB_INTEGRITY_DIGEST == integrityType),
+                    QLIB_STATUS__INVALID_PARAMETER);
+#ifndef QLIB_HASH_STREAM_ENABLED
+    QLIB_ASSERT_RET(QLIB_INTEGRITY_DIGEST != integrityType, QLIB_STATUS__NOT_SUPPORTED);
+#endif
+
+    memset(scrub, 0, sizeof(QLIB_UTILS_SCRUB_CTX_T));
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Get the configured integrity values and the integrity area                                          */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(QLIB_GetSectionConfiguration(qlibContext,
+                                                       sectionId,
+                                                       NULL,
+                                                       &scrub->size,
+                                                       &policy,
+                                                       &scrub->expectedDigest,
+                                                       &scrub->expectedCrc,
+                                                       NULL));
+    QLIB_ASSERT_RET((QLIB_INTEGRITY_CRC == integrityType) ? (1 == policy.checksumIntegrity) : (1 == policy.digestIntegrity),
+                    QLIB_STATUS__SYSTEM_IN_INCORRECT_STATE);
+
+    if (1 == policy.rollbackProt)
+    {
+        scrub->size = scrub->size / 2;
+    }
+
+    scrub->sectionId     = sectionId;
+    scrub->integrityType = integrityType;
+    scrub->crc           = 0xFFFFFFFFL;
+#ifdef QLIB_HASH_STREAM_ENABLED
+    if (QLIB_INTEGRITY_DIGEST == integrityType)
+    {
+        QLIB_STATUS_RET_CHECK(QLIB_UTILS_DigestInit(&scrub->digest));
+    }
+#endif
+
+    return QLIB_STATUS__OK;
+}
+
+QLIB_STATUS_T QLIB_UTILS_ScrubStep(QLIB_CONTEXT_T*         qlibContext,
+                                   QLIB_UTILS_SCRUB_CTX_T* scrub,
+                                   U32*                    buf,
+                                   U32                     bufSize,
+                                   U32                     budgetUs,
+                                   BOOL*                   done)
+{
+    U32 startUs  = PLAT_GetTimeUs();
+    U32 readUs   = 0;
+    U32 elapsed  = 0;
+    U32 readSize = 0;
+    U32 i        = 0;
+#ifdef QLIB_HASH_STREAM_ENABLED
+    U64 digest = 0;
+#endif
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != scrub, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != buf, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != done, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 < bufSize && 0 == (bufSize % QLIB_SEC_READ_PAGE_SIZE_BYTE), QLIB_STATUS__INVALID_PARAMETER);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* The completed check is not calculated again                                                         */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (TRUE == scrub->completed)
+    {
+        *done = TRUE;
+        return scrub->result;
+    }
+
+    *done = FALSE;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Read and calculate chunks while the budget allows. The chunk size is limited by the budget left and */
+    /* the measured throughput, so the bus is not held beyond the budget                                   */
+    /*-----------------------------------------------------------------------------------------------------*/
+    while ((scrub->offset < scrub->size) && (elapsed < budgetUs))
+    {
+        readSize = MIN(scrub->size - scrub->offset, bufSize);
+
+        if (0 == scrub->bytesPerMs)
+        {
+            // the throughput is not known yet, a single page calibrates it
+            readSize = MIN(readSize, QLIB_SEC_READ_PAGE_SIZE_BYTE);
+        }
+        else
+        {
+            U32 fitSize = (U32)MIN(((U64)(budgetUs - elapsed) * scrub->bytesPerMs) / 1000, (U64)readSize);
+
+            fitSize = fitSize - (fitSize % QLIB_SEC_READ_PAGE_SIZE_BYTE);
+            if (0 == fitSize)
+            {
+                if (0 != elapsed)
+                {
+                    break;
+                }
+                // progress at least one page per slice
+                fitSize = MIN(readSize, QLIB_SEC_READ_PAGE_SIZE_BYTE);
+            }
+            readSize = fitSize;
+        }
+
+        readUs = PLAT_GetTimeUs();
+        QLIB_STATUS_RET_CHECK(QLIB_Read(qlibContext, (U8*)buf, scrub->sectionId, scrub->offset, readSize, TRUE, FALSE));
+
+        if (QLIB_INTEGRITY_CRC == scrub->integrityType)
+        {
+            for (i = 0; i < (readSize / sizeof(U32)); i++)
+            {
+                scrub->crc = QLIB_UTILS_CRC_churn32_L(buf[i] ^ scrub->crc);
+            }
+        }
+#ifdef QLIB_HASH_STREAM_ENABLED
+        else
+        {
+            QLIB_STATUS_RET_CHECK(QLIB_UTILS_DigestUpdate(&scrub->digest, (const U8*)buf, readSize));
+        }
+#endif
+
+        /*-------------------------------------------------------------------------------------------------*/
+        /* Measure the throughput of the last chunk                                                        */
+        /*-------------------------------------------------------------------------------------------------*/
+        readUs            = PLAT_GetTimeUs() - readUs;
+        scrub->bytesPerMs = (U32)(((U64)readSize * 1000) / MAX(readUs, 1));
+        scrub->offset += readSize;
+        elapsed = PLAT_GetTimeUs() - startUs;
+    }
+
+    if (scrub->offset < scrub->size)
+    {
+        return QLIB_STATUS__OK;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Completed, compare with the configured integrity value                                              */
+    /*-----------------------------------------------------------------------------------------------------*/
+    *done         = TRUE;
+    scrub->result = QLIB_STATUS__OK;
+
+    if (QLIB_INTEGRITY_CRC == scrub->integrityType)
+    {
+        if ((scrub->crc ^ 0xFFFFFFFF) != scrub->expectedCrc)
+        {
+            scrub->result = QLIB_STATUS__DEVICE_INTEGRITY_ERR;
+        }
+    }
+#ifdef QLIB_HASH_STREAM_ENABLED
+    else
+    {
+        scrub->result = QLIB_UTILS_DigestFinal(&scrub->digest, &digest);
+        if ((QLIB_STATUS__OK == scrub->result) && (digest != scrub->expectedDigest))
+        {
+            scrub->result = QLIB_STATUS__SECURITY_ERR;
+        }
+    }
+#endif
+    scrub->completed = TRUE;
+
+    return scrub->result;
+}
+#endif // QLIB_UTILS_SCRUB_ENABLED
+
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                             LOCAL FUNCTIONS                                             */
@@ -130,3 +426,84 @@ static U32 QLIB_UTILS_CRC_churn32_L(U32 x)
     return res;
 }
 
+/************************************************************************************************************
+ * @brief       This function multiplies a GF(2) 32x32 matrix by a vector
+ *
+ * @param[in]   matrix   Matrix columns, column i is the image of bit i
+ * @param[in]   vector   Vector
+ *
+ * @return      Product
+************************************************************************************************************/
+static U32 QLIB_UTILS_CRC_MatrixTimes_L(const U32* matrix, U32 vector)
+{
+    U32 res = 0;
+
+    while (0 != vector)
+    {
+        if ((vector & 1) == 1)
+        {
+            res ^= *matrix;
+        }
+        vector >>= 1;
+        matrix++;
+    }
+    return res;
+}
+
+/************************************************************************************************************
+ * @brief       This function squares a GF(2) 32x32 matrix
+ *
+ * @param[out]  square   Square matrix columns
+ * @param[in]   matrix   Matrix columns
+************************************************************************************************************/
+static void QLIB_UTILS_CRC_MatrixSquare_L(U32* square, const U32* matrix)
+{
+    U32 i = 0;
+
+    for (i = 0; i < 32; i++)
+    {
+        square[i] = QLIB_UTILS_CRC_MatrixTimes_L(matrix, matrix[i]);
+    }
+}
+
+/************************************************************************************************************
+ * @brief       This function advances a CRC state over repeated padding words in logarithmic time.
+ *              A padding word maps the state s to M * (s ^ pad) = M * s ^ M * pad, where M is the churn32 matrix
+ *              (its columns are table32). The affine map is raised to the power @p padWords by squaring.
+ *
+ * @param[in]   state      CRC state, before the final xor
+ * @param[in]   padValue   4 bytes padding value
+ * @param[in]   padWords   Number of padding words
+ *
+ * @return      CRC state after the padding
+************************************************************************************************************/
+static U32 QLIB_UTILS_CRC_Extend_L(U32 state, U32 padValue, U32 padWords)
+{
+    U32 matrix[32];
+    U32 square[32];
+    U32 add;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* matrix and add hold the map of 2^k padding words, starting with a single word                       */
+    /*-----------------------------------------------------------------------------------------------------*/
+    memcpy(matrix, table32, sizeof(matrix));
+    add = QLIB_UTILS_CRC_churn32_L(padValue);
+
+    while (0 != padWords)
+    {
+        if ((padWords & 1) == 1)
+        {
+            state = QLIB_UTILS_CRC_MatrixTimes_L(matrix, state) ^ add;
+        }
+        padWords >>= 1;
+        if (0 != padWords)
+        {
+            add = QLIB_UTILS_CRC_MatrixTimes_L(matrix, add) ^ add;
+            QLIB_UTILS_CRC_MatrixSquare_L(square, matrix);
+            memcpy(matrix, square, sizeof(matrix));
+        }
+    }
+
+    return state;
+}
+
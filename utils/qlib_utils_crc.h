@@ -23,6 +23,47 @@ extern "C" {
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 #include "qlib.h"
+#include "qlib_utils_digest.h"
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                               DEFINITIONS                                               */
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+
+/************************************************************************************************************
+ * Section scan report, returned by @ref QLIB_UTILS_ScanSection
+************************************************************************************************************/
+typedef struct QLIB_UTILS_SCAN_STATS_T
+{
+    U32 size;        ///< Scanned size in bytes
+    U32 chunks;      ///< Number of chunk reads
+    U32 readUs;      ///< Time spent reading, in microseconds. 0 if QLIB_UTILS_SCAN_STATS_ENABLED is not defined
+    U32 calcUs;      ///< Time spent calculating CRC and digest, in microseconds. 0 if QLIB_UTILS_SCAN_STATS_ENABLED is not defined
+    U32 bytesPerSec; ///< Scan throughput in bytes per second. 0 if QLIB_UTILS_SCAN_STATS_ENABLED is not defined
+} QLIB_UTILS_SCAN_STATS_T;
+
+#ifdef QLIB_UTILS_SCRUB_ENABLED
+/************************************************************************************************************
+ * Integrity scrubber state, the resumable cursor of @ref QLIB_UTILS_ScrubStep
+************************************************************************************************************/
+typedef struct QLIB_UTILS_SCRUB_CTX_T
+{
+    U32              sectionId;      ///< Scrubbed section
+    QLIB_INTEGRITY_T integrityType;  ///< Verified integrity type
+    U32              size;           ///< Size of the section integrity area
+    U32              offset;         ///< Cursor, offset of the next read
+    U32              crc;            ///< CRC calculation state
+    U32              expectedCrc;    ///< Section configured CRC
+    U64              expectedDigest; ///< Section configured digest
+    U32              bytesPerMs;     ///< Measured read and calculation throughput, 0 before the first read
+    BOOL             completed;      ///< TRUE once the whole integrity area is read and compared
+    QLIB_STATUS_T    result;         ///< Result of the completed check
+#ifdef QLIB_HASH_STREAM_ENABLED
+    QLIB_UTILS_DIGEST_CTX_T digest; ///< Digest calculation state
+#endif
+} QLIB_UTILS_SCRUB_CTX_T;
+#endif // QLIB_UTILS_SCRUB_ENABLED
 
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
@@ -47,6 +88,38 @@ extern "C" {
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_UTILS_CalcCRCWithPadding(const U32* buf, U32 size, U32 padValue, U32 padSize, U32* crc);
 
+/************************************************************************************************************
+ * @brief       This function extends a CRC with padding, in logarithmic time of the padding size.
+ *              The result is the CRC of the original data followed by @p padSize bytes of padding.
+ *
+ * @param[in]   crc          CRC value of the data
+ * @param[in]   padValue     4 bytes padding after data value
+ * @param[in]   padSize      padding after data size
+ * @param[out]  extendedCrc  CRC value of the data and the padding
+ *
+ * @return
+ * QLIB_STATUS__OK = 0              - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p extendedCrc is NULL\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p padSize is not multiply of 4
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_UTILS_CRCExtend(U32 crc, U32 padValue, U32 padSize, U32* extendedCrc);
+
+/************************************************************************************************************
+ * @brief       This function combines the CRC values of two consecutive data blocks, in logarithmic time of
+ *              the second block size. The result is the CRC of the first block followed by the second block.
+ *
+ * @param[in]   crc1     CRC value of the first block
+ * @param[in]   crc2     CRC value of the second block
+ * @param[in]   size2    second block size
+ * @param[out]  crc      CRC value of both blocks
+ *
+ * @return
+ * QLIB_STATUS__OK = 0              - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p crc is NULL\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p size2 is not multiply of 4
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_UTILS_CRCCombine(U32 crc1, U32 crc2, U32 size2, U32* crc);
+
 /************************************************************************************************************
  * @brief       This function calculates the checksum of a given section.
  *              The function assumes there is an open session to the section with full or restricted access.
@@ -61,6 +134,96 @@ QLIB_STATUS_T QLIB_UTILS_CalcCRCWithPadding(const U32* buf, U32 size, U32 padVal
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_UTILS_CalcCRCForSection(QLIB_CONTEXT_T* qlibContext, U32 sectionId, U32 offset, U32 dataSize, U32* crc);
 
+/************************************************************************************************************
+ * @brief       This function scans a section once and calculates its checksum and digest together.
+ *              The section is read sequentially in chunks of @p bufSize bytes, and each chunk is added to the CRC
+ *              and to the digest before the next chunk is read. When QLIB_SEC_READ_AHEAD_ENABLED is defined, the
+ *              read of the next chunk starts while the current chunk is calculated.
+ *              The function assumes there is an open session to the section with full or restricted access.
+ *
+ * @param       qlibContext  qlib context object
+ * @param[in]   sectionId    Section Id to read from
+ * @param[in]   offset       Start offset inside the section
+ * @param[in]   dataSize     Data size
+ * @param[in]   buf          Chunk buffer
+ * @param[in]   bufSize      Chunk buffer size, the chunk size. Multiply of 4
+ * @param[out]  crc          Result checksum value, may be NULL
+ * @param[out]  digest       Result digest value, may be NULL. Supported if QLIB_HASH_STREAM_ENABLED is defined
+ * @param[out]  stats        Scan report, may be NULL
+ *
+ * @return
+ * QLIB_STATUS__OK = 0              - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p buf is NULL, or both @p crc and @p digest are NULL\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p bufSize is 0 or not multiply of 4\n
+ * QLIB_STATUS__NOT_SUPPORTED       - @p digest is not NULL and QLIB_HASH_STREAM_ENABLED is not defined\n
+ * QLIB_STATUS__(ERROR)             - Other error
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_UTILS_ScanSection(QLIB_CONTEXT_T*          qlibContext,
+                                     U32                      sectionId,
+                                     U32                      offset,
+                                     U32                      dataSize,
+                                     U32*                     buf,
+                                     U32                      bufSize,
+                                     U32*                     crc,
+                                     U64*                     digest,
+                                     QLIB_UTILS_SCAN_STATS_T* stats);
+
+#ifdef QLIB_UTILS_SCRUB_ENABLED
+/************************************************************************************************************
+ * @brief       This function starts an incremental integrity check of a section.
+ *              The section integrity area, the whole section or the active half of a rollback protected section,
+ *              is verified by @ref QLIB_UTILS_ScrubStep calls, against the configured CRC or digest of the section.
+ *              The function assumes there is an open session to the section with full or restricted access.
+ *
+ * @param       qlibContext    qlib context object
+ * @param[out]  scrub          Scrubber state
+ * @param[in]   sectionId      Section Id to verify
+ * @param[in]   integrityType  The integrity type to verify
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                      - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER           - @p scrub is NULL or @p integrityType is invalid\n
+ * QLIB_STATUS__NOT_SUPPORTED               - digest integrity type and QLIB_HASH_STREAM_ENABLED is not defined\n
+ * QLIB_STATUS__SYSTEM_IN_INCORRECT_STATE   - the section policy has no integrity of @p integrityType\n
+ * QLIB_STATUS__(ERROR)                     - Other error
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_UTILS_ScrubStart(QLIB_CONTEXT_T*         qlibContext,
+                                    QLIB_UTILS_SCRUB_CTX_T* scrub,
+                                    U32                     sectionId,
+                                    QLIB_INTEGRITY_T        integrityType);
+
+/************************************************************************************************************
+ * @brief       This function performs one bounded time slice of an incremental integrity check.
+ *              The section is read from the cursor in chunks of up to @p bufSize bytes, sized by the measured
+ *              throughput to fit in the time left of @p budgetUs. A slice reads at least one page, and the first
+ *              chunk is a single page which calibrates the throughput.
+ *              When the whole integrity area is read, the result is compared with the configured CRC or digest.
+ *              Once completed, further calls return the same result without reading.
+ *              The function assumes there is an open session to the section with full or restricted access.
+ *
+ * @param       qlibContext  qlib context object
+ * @param[in,out] scrub      Scrubber state
+ * @param[in]   buf          Chunk buffer
+ * @param[in]   bufSize      Chunk buffer size. Multiply of 32
+ * @param[in]   budgetUs     Time budget of the slice, in microseconds
+ * @param[out]  done         TRUE if the check is completed
+ *
+ * @return
+ * QLIB_STATUS__OK = 0                  - no error occurred, or the check is completed successfully\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p scrub, @p buf or @p done is NULL\n
+ * QLIB_STATUS__INVALID_PARAMETER       - @p bufSize is 0 or not multiply of 32\n
+ * QLIB_STATUS__DEVICE_INTEGRITY_ERR    - the check is completed and the section CRC is incorrect\n
+ * QLIB_STATUS__SECURITY_ERR            - the check is completed and the section digest is incorrect\n
+ * QLIB_STATUS__(ERROR)                 - Other error
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_UTILS_ScrubStep(QLIB_CONTEXT_T*         qlibContext,
+                                   QLIB_UTILS_SCRUB_CTX_T* scrub,
+                                   U32*                    buf,
+                                   U32                     bufSize,
+                                   U32                     budgetUs,
+                                   BOOL*                   done);
+#endif // QLIB_UTILS_SCRUB_ENABLED
+
 #ifdef __cplusplus
 }
 #endif
@@ -18,6 +18,15 @@
 /*---------------------------------------------------------------------------------------------------------*/
 #include "qlib_utils_digest.h"
 
+#ifdef QLIB_HASH_STREAM_ENABLED
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                               DEFINITIONS                                               */
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+#define QLIB_UTILS_DIGEST_PAD_WORDS 16
+#endif // QLIB_HASH_STREAM_ENABLED
+
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                           INTERFACE FUNCTIONS                                           */
@@ -56,3 +65,99 @@ QLIB_STATUS_T QLIB_UTILS_CalcDigest(U32* buf, U32 size, U64* digest)
 
     return QLIB_STATUS__OK;
 }
+
+#ifdef QLIB_HASH_STREAM_ENABLED
+QLIB_STATUS_T QLIB_UTILS_DigestInit(QLIB_UTILS_DIGEST_CTX_T* ctx)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != ctx, QLIB_STATUS__INVALID_PARAMETER);
+
+    PLAT_HASH_Init(&ctx->hash);
+    ctx->size = 0;
+
+    return QLIB_STATUS__OK;
+}
+
+QLIB_STATUS_T QLIB_UTILS_DigestUpdate(QLIB_UTILS_DIGEST_CTX_T* ctx, const U8* buf, U32 size)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != ctx, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != buf || 0 == size, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET((ctx->size + size) >= size, QLIB_STATUS__PARAMETER_OUT_OF_RANGE);
+
+    if (0 < size)
+    {
+        PLAT_HASH_Update(&ctx->hash, buf, size);
+        ctx->size += size;
+    }
+
+    return QLIB_STATUS__OK;
+}
+
+QLIB_STATUS_T QLIB_UTILS_DigestUpdatePadding(QLIB_UTILS_DIGEST_CTX_T* ctx, U32 padValue, U32 padSize)
+{
+    U32 pad[QLIB_UTILS_DIGEST_PAD_WORDS];
+    U32 chunk;
+    U32 i;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != ctx, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 == (padSize % (sizeof(U32))), QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET((ctx->size + padSize) >= padSize, QLIB_STATUS__PARAMETER_OUT_OF_RANGE);
+
+    for (i = 0; i < QLIB_UTILS_DIGEST_PAD_WORDS; i++)
+    {
+        pad[i] = padValue;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Add the padding in chunks of the padding buffer                                                     */
+    /*-----------------------------------------------------------------------------------------------------*/
+    while (0 < padSize)
+    {
+        chunk = MIN(padSize, sizeof(pad));
+        PLAT_HASH_Update(&ctx->hash, (const U8*)pad, chunk);
+        ctx->size += chunk;
+        padSize -= chunk;
+    }
+
+    return QLIB_STATUS__OK;
+}
+
+QLIB_STATUS_T QLIB_UTILS_DigestFinal(QLIB_UTILS_DIGEST_CTX_T* ctx, U64* digest)
+{
+    _256BIT hash_result;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != ctx, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != digest, QLIB_STATUS__INVALID_PARAMETER);
+
+    if (0 == ctx->size)
+    {
+        ((U32*)digest)[0] = 0;
+        ((U32*)digest)[1] = 0;
+        return QLIB_STATUS__INVALID_PARAMETER;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Calculate digest                                                                                    */
+    /*-----------------------------------------------------------------------------------------------------*/
+    PLAT_HASH_Final(&ctx->hash, hash_result);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Set output, same as QLIB_UTILS_CalcDigest                                                           */
+    /*-----------------------------------------------------------------------------------------------------*/
+    ((U32*)digest)[0] = hash_result[6];
+    ((U32*)digest)[1] = hash_result[7];
+
+    return QLIB_STATUS__OK;
+}
+#endif // QLIB_HASH_STREAM_ENABLED
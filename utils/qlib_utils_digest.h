@@ -24,6 +24,23 @@ extern "C" {
 /*---------------------------------------------------------------------------------------------------------*/
 #include "qlib.h"
 
+#ifdef QLIB_HASH_STREAM_ENABLED
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                               DEFINITIONS                                               */
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+
+/************************************************************************************************************
+ * Streaming digest state
+************************************************************************************************************/
+typedef struct QLIB_UTILS_DIGEST_CTX_T
+{
+    PLAT_HASH_CTX_T hash; ///< Platform hash state
+    U32             size; ///< Number of bytes added so far
+} QLIB_UTILS_DIGEST_CTX_T;
+#endif // QLIB_HASH_STREAM_ENABLED
+
 /*---------------------------------------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------*/
 /*                                           INTERFACE FUNCTIONS                                           */
@@ -45,6 +62,64 @@ extern "C" {
 ************************************************************************************************************/
 QLIB_STATUS_T QLIB_UTILS_CalcDigest(U32* buf, U32 size, U64* digest);
 
+#ifdef QLIB_HASH_STREAM_ENABLED
+/************************************************************************************************************
+ * @brief       This function starts a streaming digest calculation.
+ *              The data is added using @ref QLIB_UTILS_DigestUpdate in chunks of any size, and the digest
+ *              returned by @ref QLIB_UTILS_DigestFinal is the same as of @ref QLIB_UTILS_CalcDigest over the
+ *              whole data, which is the digest reported by the device for a section.
+ *
+ * @param[out]  ctx      digest state
+ *
+ * @return
+ * QLIB_STATUS__OK = 0              - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p ctx is NULL
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_UTILS_DigestInit(QLIB_UTILS_DIGEST_CTX_T* ctx);
+
+/************************************************************************************************************
+ * @brief       This function adds data to a streaming digest calculation
+ *
+ * @param[in,out] ctx    digest state
+ * @param[in]   buf      data buffer
+ * @param[in]   size     data buffer size
+ *
+ * @return
+ * QLIB_STATUS__OK = 0              - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p ctx is NULL, or @p buf is NULL and @p size is not 0\n
+ * QLIB_STATUS__PARAMETER_OUT_OF_RANGE - the total data size exceeds 4GB
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_UTILS_DigestUpdate(QLIB_UTILS_DIGEST_CTX_T* ctx, const U8* buf, U32 size);
+
+/************************************************************************************************************
+ * @brief       This function adds padding to a streaming digest calculation, e.g. the erased part of a section
+ *
+ * @param[in,out] ctx    digest state
+ * @param[in]   padValue 4 bytes padding value
+ * @param[in]   padSize  padding size
+ *
+ * @return
+ * QLIB_STATUS__OK = 0              - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p ctx is NULL\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p padSize is not multiply of 4\n
+ * QLIB_STATUS__PARAMETER_OUT_OF_RANGE - the total data size exceeds 4GB
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_UTILS_DigestUpdatePadding(QLIB_UTILS_DIGEST_CTX_T* ctx, U32 padValue, U32 padSize);
+
+/************************************************************************************************************
+ * @brief       This function ends a streaming digest calculation
+ *
+ * @param[in,out] ctx    digest state
+ * @param[out]  digest   digest value
+ *
+ * @return
+ * QLIB_STATUS__OK = 0              - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p ctx or @p digest is NULL\n
+ * QLIB_STATUS__INVALID_PARAMETER   - no data was added
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_UTILS_DigestFinal(QLIB_UTILS_DIGEST_CTX_T* ctx, U64* digest);
+#endif // QLIB_HASH_STREAM_ENABLED
+
 #ifdef __cplusplus
 }
 #endif
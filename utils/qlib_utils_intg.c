@@ -0,0 +1,185 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_utils_intg.c
+* @brief      This file contains integrity check caching utility functions
+*
+* ### project qlib
+*
+************************************************************************************************************/
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                INCLUDES                                                 */
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+#include "qlib_utils_intg.h"
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                               DEFINITIONS                                               */
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+#define QLIB_UTILS_INTG_RECORD_MAGIC 0x47544E49 // "INTG"
+
+/************************************************************************************************************
+ * DMC advance after which an unchanged section is verified again. 0 means the verification does not age.
+ * User may choose to define a different value.
+************************************************************************************************************/
+#ifndef QLIB_UTILS_INTG_MAX_DMC_AGE
+#define QLIB_UTILS_INTG_MAX_DMC_AGE 0
+#endif
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                           INTERFACE FUNCTIONS                                           */
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+
+QLIB_STATUS_T QLIB_UTILS_IntgCacheLoad(QLIB_CONTEXT_T*          qlibContext,
+                                       QLIB_UTILS_INTG_CACHE_T* cache,
+                                       U32                      recordSection,
+                                       U32                      recordOffset)
+{
+    QLIB_POLICY_T policy;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != cache, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(0 == (recordOffset % FLASH_SECTOR_SIZE), QLIB_STATUS__INVALID_PARAMETER);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* The record is trusted only if it can be written by secure writes only, with the section key         */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(QLIB_GetSectionConfiguration(qlibContext, recordSection, NULL, NULL, &policy, NULL, NULL, NULL));
+    QLIB_ASSERT_RET(0 == policy.plainAccessWriteEnable, QLIB_STATUS__SECURITY_ERR);
+    QLIB_ASSERT_RET(0 == policy.writeProt, QLIB_STATUS__DEVICE_PRIVILEGE_ERR);
+
+    memset(cache, 0, sizeof(QLIB_UTILS_INTG_CACHE_T));
+    cache->recordSection = recordSection;
+    cache->recordOffset  = recordOffset;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Authenticated read, the record content is not altered on the way from the flash                     */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(
+        QLIB_Read(qlibContext, (U8*)&cache->record, recordSection, recordOffset, sizeof(QLIB_UTILS_INTG_RECORD_T), TRUE, TRUE));
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Erased or invalid record, no section is verified                                                    */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (QLIB_UTILS_INTG_RECORD_MAGIC != cache->record.magic)
+    {
+        memset(&cache->record, 0, sizeof(QLIB_UTILS_INTG_RECORD_T));
+        cache->record.magic = QLIB_UTILS_INTG_RECORD_MAGIC;
+        cache->dirty        = TRUE;
+    }
+
+    return QLIB_STATUS__OK;
+}
+
+QLIB_STATUS_T QLIB_UTILS_IntgCacheCheck(QLIB_CONTEXT_T*          qlibContext,
+                                        QLIB_UTILS_INTG_CACHE_T* cache,
+                                        U32                      sectionID,
+                                        QLIB_INTEGRITY_T         integrityType,
+                                        BOOL                     force)
+{
+    QLIB_UTILS_INTG_ENTRY_T* entry;
+    QLIB_POLICY_T            policy;
+    U64                      digest  = 0;
+    U32                      crc     = 0;
+    U32                      version = 0;
+    U32                      typeBit = 0;
+    BOOL                     changed = FALSE;
+    QLIB_STATUS_T            ret     = QLIB_STATUS__OK;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != cache, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(QLIB_NUM_OF_SECTIONS > sectionID, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET((QLIB_INTEGRITY_CRC == integrityType) || (QLIB_INTEGRITY_DIGEST == integrityType),
+                    QLIB_STATUS__INVALID_PARAMETER);
+
+    entry   = &cache->record.sections[sectionID];
+    typeBit = (1u << (U32)integrityType);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Get the current section configuration                                                               */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(QLIB_GetSectionConfiguration(qlibContext, sectionID, NULL, NULL, &policy, &digest, &crc, &version));
+
+    changed = ((entry->digest != digest) || (entry->crc != crc) || (entry->version != version)) ? TRUE : FALSE;
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* A protected section can not change without changing its configuration, so an unchanged section      */
+    /* which was verified by this integrity type is not verified again                                     */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if ((FALSE == force) && (FALSE == changed) && (0 != (entry->verified & typeBit)) &&
+        ((1 == policy.writeProt) || (1 == policy.rollbackProt))
+#if QLIB_UTILS_INTG_MAX_DMC_AGE
+        && ((qlibContext->mc[DMC] - entry->dmc) < QLIB_UTILS_INTG_MAX_DMC_AGE)
+#endif
+    )
+    {
+        cache->report.skipped |= (1u << sectionID);
+        return QLIB_STATUS__OK;
+    }
+
+    ret = QLIB_CheckIntegrity(qlibContext, sectionID, integrityType);
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Update the record                                                                                   */
+    /*-----------------------------------------------------------------------------------------------------*/
+    if (QLIB_STATUS__OK == ret)
+    {
+        entry->verified   = ((TRUE == changed) ? 0 : entry->verified) | typeBit;
+        entry->digest     = digest;
+        entry->crc        = crc;
+        entry->version    = version;
+        entry->dmc        = qlibContext->mc[DMC];
+        cache->report.checked |= (1u << sectionID);
+    }
+    else
+    {
+        entry->verified = 0;
+        cache->report.failed |= (1u << sectionID);
+    }
+    cache->dirty = TRUE;
+
+    return ret;
+}
+
+QLIB_STATUS_T QLIB_UTILS_IntgCacheStore(QLIB_CONTEXT_T* qlibContext, QLIB_UTILS_INTG_CACHE_T* cache)
+{
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Error checking                                                                                      */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_ASSERT_RET(NULL != qlibContext, QLIB_STATUS__INVALID_PARAMETER);
+    QLIB_ASSERT_RET(NULL != cache, QLIB_STATUS__INVALID_PARAMETER);
+
+    if (FALSE == cache->dirty)
+    {
+        return QLIB_STATUS__OK;
+    }
+
+    /*-----------------------------------------------------------------------------------------------------*/
+    /* Rewrite the record sector by secure commands                                                        */
+    /*-----------------------------------------------------------------------------------------------------*/
+    QLIB_STATUS_RET_CHECK(QLIB_Erase(qlibContext, cache->recordSection, cache->recordOffset, FLASH_SECTOR_SIZE, TRUE));
+    QLIB_STATUS_RET_CHECK(QLIB_Write(qlibContext,
+                                     (const U8*)&cache->record,
+                                     cache->recordSection,
+                                     cache->recordOffset,
+                                     sizeof(QLIB_UTILS_INTG_RECORD_T),
+                                     TRUE));
+    cache->dirty = FALSE;
+
+    return QLIB_STATUS__OK;
+}
@@ -0,0 +1,157 @@
+/************************************************************************************************************
+* @internal
+* @remark     Winbond Electronics Corporation - Confidential
+* @copyright  Copyright (c) 2021 by Winbond Electronics Corporation . All rights reserved
+* @endinternal
+*
+* @file       qlib_utils_intg.h
+* @brief      This file contains integrity check caching utility functions
+*
+* ### project qlib
+*
+************************************************************************************************************/
+#ifndef __QLIB_UTILS_INTG_H__
+#define __QLIB_UTILS_INTG_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                INCLUDES                                                 */
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+#include "qlib.h"
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                               DEFINITIONS                                               */
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+
+/************************************************************************************************************
+ * Integrity state of one section, as verified by the last successful integrity check
+************************************************************************************************************/
+typedef struct QLIB_UTILS_INTG_ENTRY_T
+{
+    U64 digest;   ///< Section configured digest
+    U32 crc;      ///< Section configured CRC
+    U32 version;  ///< Section version
+    U32 dmc;      ///< DMC value at the verification
+    U32 verified; ///< Verified integrity types, bit per @ref QLIB_INTEGRITY_T. 0 if the section is not verified
+} QLIB_UTILS_INTG_ENTRY_T;
+
+/************************************************************************************************************
+ * Integrity state record, as stored in the flash
+************************************************************************************************************/
+typedef struct QLIB_UTILS_INTG_RECORD_T
+{
+    U32                     magic;                         ///< QLIB_UTILS_INTG_RECORD_MAGIC if the record is valid
+    U32                     reserved;                      ///< Reserved, 0
+    QLIB_UTILS_INTG_ENTRY_T sections[QLIB_NUM_OF_SECTIONS]; ///< Integrity state of each section
+} QLIB_UTILS_INTG_RECORD_T;
+
+/************************************************************************************************************
+ * Integrity checks report, bit per section
+************************************************************************************************************/
+typedef struct QLIB_UTILS_INTG_REPORT_T
+{
+    U32 checked; ///< Sections verified by the device
+    U32 skipped; ///< Sections whose verification was skipped, since they are unchanged since their last verification
+    U32 failed;  ///< Sections which failed the verification
+} QLIB_UTILS_INTG_REPORT_T;
+
+/************************************************************************************************************
+ * Integrity check cache
+************************************************************************************************************/
+typedef struct QLIB_UTILS_INTG_CACHE_T
+{
+    QLIB_UTILS_INTG_RECORD_T record;        ///< Integrity state record
+    QLIB_UTILS_INTG_REPORT_T report;        ///< Report of the checks since the record was loaded
+    U32                      recordSection; ///< Section of the record
+    U32                      recordOffset;  ///< Offset of the record, sector aligned
+    BOOL                     dirty;         ///< The record was changed since it was loaded or stored
+} QLIB_UTILS_INTG_CACHE_T;
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                           INTERFACE FUNCTIONS                                           */
+/*---------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------*/
+
+/************************************************************************************************************
+ * @brief       This function loads the integrity state record from a dedicated flash sector.
+ *
+ * The record is read by an authenticated secure read. The record section policy must not permit plain write
+ * or write protection, so the record can be written only by secure writes with the section key.
+ * If the sector does not hold a valid record, all the sections are marked as not verified.
+ * Session to @p recordSection must be open.
+ *
+ * @param[out]  qlibContext     [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[out]  cache           integrity check cache
+ * @param[in]   recordSection   [Section index](md_definitions.html#DEF_SECTION) of the record
+ * @param[in]   recordOffset    [Section offset](md_definitions.html#DEF_OFFSET) of the record sector
+ *
+ * @return
+ * QLIB_STATUS__OK = 0              - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p qlibContext or @p cache is NULL\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p recordOffset is not sector aligned\n
+ * QLIB_STATUS__SECURITY_ERR        - @p recordSection permits plain write\n
+ * QLIB_STATUS__DEVICE_PRIVILEGE_ERR - @p recordSection is write protected\n
+ * QLIB_STATUS__(ERROR)             - Other error, see @ref QLIB_Read
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_UTILS_IntgCacheLoad(QLIB_CONTEXT_T*          qlibContext,
+                                       QLIB_UTILS_INTG_CACHE_T* cache,
+                                       U32                      recordSection,
+                                       U32                      recordOffset);
+
+/************************************************************************************************************
+ * @brief       This function performs an integrity check of a section, unless it is unchanged since its
+ *              last verification.
+ *
+ * The check is skipped if the section is write protected or rollback protected, its version, configured digest
+ * and configured CRC are the same as at its last verification by the same integrity type, and the DMC advanced by
+ * less than QLIB_UTILS_INTG_MAX_DMC_AGE since then. Otherwise @ref QLIB_CheckIntegrity is performed and the
+ * record is updated. The result is added to the cache report.\n
+ * Session to @p sectionID must be open.
+ *
+ * @param[out]  qlibContext     [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in,out] cache         integrity check cache
+ * @param[in]   sectionID       [Section index](md_definitions.html#DEF_SECTION)
+ * @param[in]   integrityType   The integrity type to perform
+ * @param[in]   force           If TRUE the integrity check is always performed
+ *
+ * @return
+ * QLIB_STATUS__OK = 0              - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p qlibContext or @p cache is NULL\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p sectionID or @p integrityType is invalid\n
+ * QLIB_STATUS__(ERROR)             - Other error, see @ref QLIB_CheckIntegrity
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_UTILS_IntgCacheCheck(QLIB_CONTEXT_T*          qlibContext,
+                                        QLIB_UTILS_INTG_CACHE_T* cache,
+                                        U32                      sectionID,
+                                        QLIB_INTEGRITY_T         integrityType,
+                                        BOOL                     force);
+
+/************************************************************************************************************
+ * @brief       This function stores the integrity state record, if it was changed.
+ *
+ * The record sector is erased and the record is written by secure write.
+ * Session to the record section must be open with full access.
+ *
+ * @param[out]  qlibContext     [QLIB internal state](md_definitions.html#DEF_CONTEXT)
+ * @param[in,out] cache         integrity check cache
+ *
+ * @return
+ * QLIB_STATUS__OK = 0              - no error occurred\n
+ * QLIB_STATUS__INVALID_PARAMETER   - @p qlibContext or @p cache is NULL\n
+ * QLIB_STATUS__(ERROR)             - Other error, see @ref QLIB_Erase and @ref QLIB_Write
+************************************************************************************************************/
+QLIB_STATUS_T QLIB_UTILS_IntgCacheStore(QLIB_CONTEXT_T* qlibContext, QLIB_UTILS_INTG_CACHE_T* cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __QLIB_UTILS_INTG_H__